@@ -0,0 +1,54 @@
+// Copyright (c) Entropy Software LLC
+// This file is licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+#pragma once
+
+#include "Entropy/Core/Details/Defines.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+namespace Entropy
+{
+namespace Benchmarks
+{
+
+/// <summary>
+/// Prevents the compiler from optimizing away a value that is only computed for the benchmark.
+/// </summary>
+template <typename T>
+inline void DoNotOptimize(const T& value)
+{
+#if defined(_MSC_VER)
+    const volatile char* volatile sink = reinterpret_cast<const volatile char*>(&value);
+    (void)sink;
+#else
+    asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+/// <summary>
+/// Runs func the specified number of times and returns the average number of nanoseconds each call took.
+/// </summary>
+template <typename TFunc>
+double MeasureNanosecondsPerOp(int64 iterations, TFunc&& func)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int64 i = 0; i < iterations; ++i)
+    {
+        func(i);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(iterations);
+}
+
+inline void ReportResult(const char* name, double nanosecondsPerOp)
+{
+    std::cout << std::left << std::setw(60) << name << std::right << std::setw(12) << std::fixed
+              << std::setprecision(2) << nanosecondsPerOp << " ns/op" << std::endl;
+}
+
+} // namespace Benchmarks
+} // namespace Entropy
@@ -0,0 +1,115 @@
+// Copyright (c) Entropy Software LLC
+// This file is licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+#include "BenchmarkUtils.h"
+#include "Entropy/Core/Details/AllocatorTraits.h"
+#include "Entropy/Reflection.h"
+#include "Entropy/Reflection/DataObject/DataObjectContainerPool.h"
+#include <atomic>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Entropy
+{
+namespace Benchmarks
+{
+namespace DataObject
+{
+
+static constexpr int64 cPoolIterations = 200000;
+static constexpr int cLiveBlockCount   = 16;
+
+using Pool = details::DataObjectContainerPool;
+
+// Same size and alignment as a pooled block, allocated straight from the system allocator
+struct MyMallocBlock
+{
+    MyMallocBlock() {}
+
+    typename std::aligned_storage<Pool::cBlockSize, Pool::cBlockAlignment>::type storage;
+};
+
+// Runs func on threadCount threads at once and returns the average time per call across all threads
+template <typename TFunc>
+double MeasureOnThreads(int threadCount, TFunc&& func)
+{
+    std::atomic_bool start{false};
+    std::vector<double> results(threadCount);
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([&, t]() {
+            while (!start.load())
+            {
+                std::this_thread::yield();
+            }
+            results[t] = MeasureNanosecondsPerOp(cPoolIterations, func);
+        });
+    }
+
+    start.store(true);
+
+    double total = 0.0;
+    for (int t = 0; t < threadCount; ++t)
+    {
+        threads[t].join();
+        total += results[t];
+    }
+
+    return total / threadCount;
+}
+
+} // namespace DataObject
+} // namespace Benchmarks
+} // namespace Entropy
+
+int DataObject_BenchDataObjectContainerPool(int argc, char** const argv)
+{
+    using namespace Entropy;
+    using namespace Entropy::Benchmarks;
+    using namespace Entropy::Benchmarks::DataObject;
+
+    const Entropy::TypeInfo* typeInfo = ReflectTypeAndGetTypeInfo<int>();
+
+    for (int threadCount : {1, 8, 32})
+    {
+        std::cout << threadCount << " thread(s), " << cLiveBlockCount << " live blocks per op" << std::endl;
+
+        // Each op allocates a handful of blocks and then frees them, so the allocator cannot just hand back one block
+        ReportResult("  malloc: allocate + free", MeasureOnThreads(threadCount, [&](int64) {
+                         MyMallocBlock* blocks[cLiveBlockCount];
+                         for (int i = 0; i < cLiveBlockCount; ++i)
+                         {
+                             blocks[i] = AllocatorOps::CreateInstance<MyMallocBlock>();
+                         }
+                         DoNotOptimize(blocks);
+                         for (int i = 0; i < cLiveBlockCount; ++i)
+                         {
+                             AllocatorOps::DestroyInstance(blocks[i]);
+                         }
+                     }));
+
+        ReportResult("  pool: allocate + free", MeasureOnThreads(threadCount, [&](int64) {
+                         void* blocks[cLiveBlockCount];
+                         for (int i = 0; i < cLiveBlockCount; ++i)
+                         {
+                             blocks[i] = Pool::Allocate();
+                         }
+                         DoNotOptimize(blocks);
+                         for (int i = 0; i < cLiveBlockCount; ++i)
+                         {
+                             Pool::Free(blocks[i]);
+                         }
+                     }));
+
+        ReportResult("  pool: DataObject create + destroy", MeasureOnThreads(threadCount, [&](int64) {
+                         Entropy::DataObject obj = typeInfo->Construct();
+                         DoNotOptimize(obj);
+                     }));
+    }
+
+    return 0;
+}
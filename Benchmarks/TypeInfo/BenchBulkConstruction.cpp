@@ -0,0 +1,103 @@
+// Copyright (c) Entropy Software LLC
+// This file is licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+#include "BenchmarkUtils.h"
+#include "Entropy/Reflection.h"
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Entropy
+{
+namespace Benchmarks
+{
+namespace TypeInfo
+{
+
+static constexpr int64 cBulkIterations     = 2000;
+static constexpr std::size_t cElementCount = 4096;
+
+struct MyPodElement
+{
+    float position[3];
+    int id;
+};
+
+struct MyNonPodElement
+{
+    std::string name{"element"};
+    int id = 0;
+};
+
+template <typename T>
+void BenchmarkElementType(const char* typeName)
+{
+    using StorageType = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+    const Entropy::TypeInfo* typeInfo = ReflectTypeAndGetTypeInfo<T>();
+
+    std::vector<StorageType> src(cElementCount);
+    std::vector<StorageType> dst(cElementCount);
+
+    typeInfo->ConstructN(src.data(), cElementCount);
+
+    const std::string prefix = std::string(typeName) + " x" + std::to_string(cElementCount) + ": ";
+
+    // One handler call per element, as was required before the bulk handlers existed
+    ReportResult((prefix + "ConstructAt + DestructAt per element").c_str(),
+                 MeasureNanosecondsPerOp(cBulkIterations, [&](int64) {
+                     for (StorageType& element : dst)
+                     {
+                         typeInfo->ConstructAt(&element);
+                     }
+                     DoNotOptimize(dst.data());
+                     for (StorageType& element : dst)
+                     {
+                         typeInfo->DestructAt(&element);
+                     }
+                 }));
+
+    ReportResult((prefix + "ConstructN + DestructN").c_str(), MeasureNanosecondsPerOp(cBulkIterations, [&](int64) {
+                     typeInfo->ConstructN(dst.data(), cElementCount);
+                     DoNotOptimize(dst.data());
+                     typeInfo->DestructN(dst.data(), cElementCount);
+                 }));
+
+    ReportResult((prefix + "CopyConstructAt + DestructAt per element").c_str(),
+                 MeasureNanosecondsPerOp(cBulkIterations, [&](int64) {
+                     for (std::size_t i = 0; i < cElementCount; ++i)
+                     {
+                         typeInfo->CopyConstructAt(&dst[i], &src[i]);
+                     }
+                     DoNotOptimize(dst.data());
+                     for (StorageType& element : dst)
+                     {
+                         typeInfo->DestructAt(&element);
+                     }
+                 }));
+
+    ReportResult((prefix + "CopyConstructN + DestructN").c_str(), MeasureNanosecondsPerOp(cBulkIterations, [&](int64) {
+                     typeInfo->CopyConstructN(dst.data(), src.data(), cElementCount);
+                     DoNotOptimize(dst.data());
+                     typeInfo->DestructN(dst.data(), cElementCount);
+                 }));
+
+    typeInfo->DestructN(src.data(), cElementCount);
+}
+
+} // namespace TypeInfo
+} // namespace Benchmarks
+} // namespace Entropy
+
+int TypeInfo_BenchBulkConstruction(int argc, char** const argv)
+{
+    using namespace Entropy::Benchmarks::TypeInfo;
+
+    std::cout << "Constructing and destroying a range of objects through TypeInfo (time per range)" << std::endl;
+
+    BenchmarkElementType<MyPodElement>("POD");
+    BenchmarkElementType<MyNonPodElement>("non-POD");
+
+    return 0;
+}
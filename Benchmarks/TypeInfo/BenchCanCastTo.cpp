@@ -0,0 +1,79 @@
+// Copyright (c) Entropy Software LLC
+// This file is licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+#include "BenchmarkUtils.h"
+#include "Entropy/Reflection.h"
+#include <vector>
+
+namespace Entropy
+{
+namespace Benchmarks
+{
+namespace TypeInfo
+{
+
+static constexpr int64 cCastIterations = 5000000;
+
+struct MyCastBenchStruct
+{
+};
+
+struct CastCase
+{
+    const char* name;
+    const Entropy::TypeInfo* from;
+    const Entropy::TypeInfo* to;
+};
+
+template <typename TFrom, typename TTo>
+CastCase MakeCastCase(const char* name)
+{
+    return CastCase{name, ReflectTypeAndGetTypeInfo<TFrom>(), ReflectTypeAndGetTypeInfo<TTo>()};
+}
+
+} // namespace TypeInfo
+} // namespace Benchmarks
+} // namespace Entropy
+
+int TypeInfo_BenchCanCastTo(int argc, char** const argv)
+{
+    using namespace Entropy;
+    using namespace Entropy::Benchmarks;
+    using namespace Entropy::Benchmarks::TypeInfo;
+
+    // A selection of the cases in Tests/TypeInfo/TestCanCastTo.cpp, from shallow to deep qualifier chains
+    std::vector<CastCase> cases = {
+        MakeCastCase<int, int>("int -> int"),
+        MakeCastCase<int, float>("int -> float"),
+        MakeCastCase<float*, const float*>("float* -> const float*"),
+        MakeCastCase<const float*, float*>("const float* -> float*"),
+        MakeCastCase<int**&, const int**>("int**& -> const int**"),
+        MakeCastCase<MyCastBenchStruct, const MyCastBenchStruct&>("Struct -> const Struct&"),
+        MakeCastCase<const MyCastBenchStruct[4], const MyCastBenchStruct* const>(
+            "const Struct[4] -> const Struct* const"),
+        MakeCastCase<const MyCastBenchStruct* [4], const MyCastBenchStruct* const*>(
+            "const Struct*[4] -> const Struct* const*"),
+        MakeCastCase<char* const[4], char** const>("char* const[4] -> char** const"),
+        MakeCastCase<MyCastBenchStruct[4][3], const MyCastBenchStruct**>("Struct[4][3] -> const Struct**"),
+    };
+
+    std::cout << "TypeInfo::CanCastTo() with the result of each pair already cached" << std::endl;
+    for (const CastCase& castCase : cases)
+    {
+        ReportResult(castCase.name, MeasureNanosecondsPerOp(cCastIterations, [&](int64) {
+                         DoNotOptimize(castCase.from->CanCastTo(castCase.to));
+                     }));
+    }
+
+    // There are more targets than cache entries per type info, so most of these calls miss and walk the qualifier
+    // chain. This approximates the uncached cost.
+    std::cout << "TypeInfo::CanCastTo() cycling through all targets from a single source" << std::endl;
+
+    const Entropy::TypeInfo* from = ReflectTypeAndGetTypeInfo<int**&>();
+    ReportResult("int**& -> each target", MeasureNanosecondsPerOp(cCastIterations, [&](int64 i) {
+                     DoNotOptimize(from->CanCastTo(cases[i % cases.size()].to));
+                 }));
+
+    return 0;
+}
@@ -0,0 +1,88 @@
+// Copyright (c) Entropy Software LLC
+// This file is licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+#include "BenchmarkUtils.h"
+#include "Entropy/Reflection.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace Entropy
+{
+namespace Benchmarks
+{
+namespace TypeInfo
+{
+
+static constexpr int cContentionThreadCount  = 32;
+static constexpr int64 cContentionIterations = 200000;
+
+struct MyContentionElement
+{
+    int value = 0;
+};
+
+// Runs func on cContentionThreadCount threads at once and returns the average time per call across all threads
+template <typename TFunc>
+double MeasureContended(TFunc&& func)
+{
+    std::atomic_bool start{false};
+    std::vector<double> results(cContentionThreadCount);
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < cContentionThreadCount; ++t)
+    {
+        threads.emplace_back([&, t]() {
+            while (!start.load())
+            {
+                std::this_thread::yield();
+            }
+            results[t] = MeasureNanosecondsPerOp(cContentionIterations, func);
+        });
+    }
+
+    start.store(true);
+
+    double total = 0.0;
+    for (int t = 0; t < cContentionThreadCount; ++t)
+    {
+        threads[t].join();
+        total += results[t];
+    }
+
+    return total / cContentionThreadCount;
+}
+
+} // namespace TypeInfo
+} // namespace Benchmarks
+} // namespace Entropy
+
+int TypeInfo_BenchDataObjectContention(int argc, char** const argv)
+{
+    using namespace Entropy;
+    using namespace Entropy::Benchmarks;
+    using namespace Entropy::Benchmarks::TypeInfo;
+
+    const Entropy::TypeInfo* typeInfo = ReflectTypeAndGetTypeInfo<MyContentionElement>();
+
+#ifdef ENTROPY_REFLECTION_IMMORTAL_TYPEINFO
+    std::cout << "Immortal type infos (TypeInfoRef is a plain pointer), " << cContentionThreadCount << " threads"
+              << std::endl;
+#else
+    std::cout << "Reference counted type infos, " << cContentionThreadCount << " threads" << std::endl;
+#endif
+
+    // Every thread shares the same type info, so each reference bumps the same counter
+    ReportResult("TypeInfoRef copy + destroy", MeasureContended([&](int64) {
+                     TypeInfoRef ref(typeInfo);
+                     DoNotOptimize(ref);
+                 }));
+
+    ReportResult("DataObject create + destroy", MeasureContended([&](int64) {
+                     DataObject obj = typeInfo->Construct();
+                     DoNotOptimize(obj);
+                 }));
+
+    return 0;
+}
@@ -0,0 +1,90 @@
+// Copyright (c) Entropy Software LLC
+// This file is licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+#include "BenchmarkUtils.h"
+#include "Entropy/Reflection.h"
+
+namespace Entropy
+{
+namespace Benchmarks
+{
+namespace TypeInfo
+{
+
+static constexpr int64 cMemberAccessIterations = 10000000;
+
+struct MyStandardLayoutBenchStruct
+{
+    ENTROPY_REFLECT_CLASS(MyStandardLayoutBenchStruct)
+
+    ENTROPY_REFLECT_MEMBER(a)
+    int a = 0;
+
+    ENTROPY_REFLECT_MEMBER(b)
+    float b = 0.0f;
+};
+
+struct MyVirtualBenchStruct
+{
+    ENTROPY_REFLECT_CLASS(MyVirtualBenchStruct)
+
+    virtual ~MyVirtualBenchStruct() {}
+
+    ENTROPY_REFLECT_MEMBER(a)
+    int a = 0;
+
+    ENTROPY_REFLECT_MEMBER(b)
+    float b = 0.0f;
+};
+
+template <typename TClass>
+void BenchMemberAccess(const char* className)
+{
+    using namespace Entropy::Reflection;
+
+    const Entropy::TypeInfo* typeInfo = ReflectTypeAndGetTypeInfo<TClass>();
+    const ClassDescription* classDesc = typeInfo->Get<ClassTypeInfo>().GetClassDescription();
+    const MemberDescription* member   = classDesc->FindMember("b");
+
+    TClass obj;
+    void* objPtr = &obj;
+
+    std::cout << className << (member->HasOffset() ? " (offset)" : " (accessor)") << std::endl;
+
+    ReportResult("  direct", MeasureNanosecondsPerOp(cMemberAccessIterations, [&](int64 i) {
+                     obj.b = static_cast<float>(i);
+                     DoNotOptimize(obj.b);
+                 }));
+
+    ReportResult("  GetMemberPtr", MeasureNanosecondsPerOp(cMemberAccessIterations, [&](int64 i) {
+                     float* value = static_cast<float*>(member->GetMemberPtr(objPtr));
+                     *value       = static_cast<float>(i);
+                     DoNotOptimize(*value);
+                 }));
+
+    ReportResult("  Set<float> + Get<float>", MeasureNanosecondsPerOp(cMemberAccessIterations, [&](int64 i) {
+                     member->Set(objPtr, static_cast<float>(i));
+                     DoNotOptimize(*member->Get<float>(objPtr));
+                 }));
+
+    ReportResult("  FindMember + GetMemberPtr", MeasureNanosecondsPerOp(cMemberAccessIterations, [&](int64) {
+                     DoNotOptimize(classDesc->FindMember("b")->GetMemberPtr(objPtr));
+                 }));
+}
+
+} // namespace TypeInfo
+} // namespace Benchmarks
+} // namespace Entropy
+
+int TypeInfo_BenchMemberAccess(int argc, char** const argv)
+{
+    using namespace Entropy;
+    using namespace Entropy::Benchmarks;
+    using namespace Entropy::Benchmarks::TypeInfo;
+
+    BenchMemberAccess<MyStandardLayoutBenchStruct>("Standard layout class");
+    BenchMemberAccess<MyVirtualBenchStruct>("Class with a vtable");
+
+    return 0;
+}
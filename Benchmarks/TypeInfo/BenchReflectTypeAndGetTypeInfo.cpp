@@ -0,0 +1,91 @@
+// Copyright (c) Entropy Software LLC
+// This file is licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+#include "BenchmarkUtils.h"
+#include "Entropy/Reflection.h"
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Entropy
+{
+namespace Benchmarks
+{
+namespace TypeInfo
+{
+
+static constexpr int64 cReflectIterations = 20000000;
+
+// Mirrors the previous ReflectTypeAndGetTypeInfo<>() fast path, which did a compare_exchange_strong on a flag that
+// lives next to the type info on every call.
+struct CasInitializedTypeInfo
+{
+    const Entropy::TypeInfo* Get()
+    {
+        bool required = true;
+        if (ENTROPY_UNLIKELY(requireInitialization.compare_exchange_strong(required, false)))
+        {
+            typeInfo = ReflectTypeAndGetTypeInfo<int>();
+        }
+        return typeInfo;
+    }
+
+    const Entropy::TypeInfo* typeInfo = nullptr;
+    std::atomic_bool requireInitialization{true};
+};
+
+template <typename TGet>
+double MeasureGets(int threadCount, TGet&& get)
+{
+    std::vector<double> results(threadCount);
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([&, t]() {
+            results[t] = MeasureNanosecondsPerOp(cReflectIterations / threadCount,
+                                                 [&](int64) { DoNotOptimize(get()); });
+        });
+    }
+
+    double total = 0.0;
+    for (int t = 0; t < threadCount; ++t)
+    {
+        threads[t].join();
+        total += results[t];
+    }
+
+    return total / threadCount;
+}
+
+} // namespace TypeInfo
+} // namespace Benchmarks
+} // namespace Entropy
+
+int TypeInfo_BenchReflectTypeAndGetTypeInfo(int argc, char** const argv)
+{
+    using namespace Entropy;
+    using namespace Entropy::Benchmarks;
+    using namespace Entropy::Benchmarks::TypeInfo;
+
+    CasInitializedTypeInfo casTypeInfo;
+
+    auto reflect    = []() { return ReflectTypeAndGetTypeInfo<int>(); };
+    auto casReflect = [&]() { return casTypeInfo.Get(); };
+
+    std::cout << "ReflectTypeAndGetTypeInfo<int>() latency on an already initialized type" << std::endl;
+
+    const int maxThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    for (int threadCount = 1; threadCount <= maxThreads; threadCount *= 2)
+    {
+        std::string suffix = " (" + std::to_string(threadCount) + " threads)";
+
+        ReportResult(("ReflectTypeAndGetTypeInfo" + suffix).c_str(), MeasureGets(threadCount, reflect));
+        ReportResult(("CAS on every call" + suffix).c_str(), MeasureGets(threadCount, casReflect));
+    }
+
+    return 0;
+}
@@ -0,0 +1,124 @@
+// Copyright (c) Entropy Software LLC
+// This file is licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+#include "BenchmarkUtils.h"
+#include "Entropy/Reflection.h"
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Entropy
+{
+namespace Benchmarks
+{
+namespace TypeInfo
+{
+
+static constexpr std::size_t cRegisteredTypeCount = 4096;
+static constexpr int64 cLookupIterations          = 10000000;
+
+template <std::size_t N>
+struct RegistryBenchType
+{
+};
+
+template <std::size_t... I>
+std::vector<TypeId> ReflectBenchTypes(std::index_sequence<I...>)
+{
+    return {ReflectTypeAndGetTypeInfo<RegistryBenchType<I>>()->GetTypeId()...};
+}
+
+template <typename TKey, typename TLookup>
+double MeasureLookups(const std::vector<TKey>& keys, int threadCount, TLookup&& lookup)
+{
+    std::vector<double> results(threadCount);
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([&, t]() {
+            // Stride through the ids so every thread touches the whole table
+            std::size_t idx = static_cast<std::size_t>(t) * 97;
+            results[t]      = MeasureNanosecondsPerOp(cLookupIterations / threadCount, [&](int64) {
+                idx = (idx + 613) & (cRegisteredTypeCount - 1);
+                DoNotOptimize(lookup(keys[idx]));
+            });
+        });
+    }
+
+    double total = 0.0;
+    for (int t = 0; t < threadCount; ++t)
+    {
+        threads[t].join();
+        total += results[t];
+    }
+
+    return total / threadCount;
+}
+
+} // namespace TypeInfo
+} // namespace Benchmarks
+} // namespace Entropy
+
+int TypeInfo_BenchTypeInfoRegistry(int argc, char** const argv)
+{
+    using namespace Entropy;
+    using namespace Entropy::Benchmarks;
+    using namespace Entropy::Benchmarks::TypeInfo;
+
+    const std::vector<TypeId> typeIds = ReflectBenchTypes(std::make_index_sequence<cRegisteredTypeCount>());
+
+    // Baseline: the straightforward alternative of a map guarded by a mutex
+    std::unordered_map<TypeId, const Entropy::TypeInfo*> lockedMap;
+    std::mutex lockedMapMutex;
+    for (TypeId typeId : typeIds)
+    {
+        lockedMap[typeId] = FindTypeById(typeId);
+    }
+
+    auto lockedLookup = [&](TypeId typeId) {
+        std::lock_guard<std::mutex> lock(lockedMapMutex);
+        return lockedMap.find(typeId)->second;
+    };
+
+    auto registryLookup = [](TypeId typeId) { return FindTypeById(typeId); };
+
+    std::cout << "Lookup latency against " << cRegisteredTypeCount << " registered types" << std::endl;
+
+    const int maxThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    for (int threadCount = 1; threadCount <= maxThreads; threadCount *= 2)
+    {
+        std::string suffix = " (" + std::to_string(threadCount) + " threads)";
+
+        ReportResult(("FindTypeById" + suffix).c_str(), MeasureLookups(typeIds, threadCount, registryLookup));
+        ReportResult(("Mutex + unordered_map" + suffix).c_str(), MeasureLookups(typeIds, threadCount, lockedLookup));
+    }
+
+    // Name lookups, before and after building the perfect hash
+    std::vector<std::string> typeNames;
+    std::unordered_map<std::string, const Entropy::TypeInfo*> nameMap;
+    for (TypeId typeId : typeIds)
+    {
+        const Entropy::TypeInfo* typeInfo = FindTypeById(typeId);
+
+        typeNames.emplace_back(StringOps::GetStr(typeInfo->GetTypeName()));
+        nameMap[typeNames.back()] = typeInfo;
+    }
+
+    auto nameMapLookup  = [&](const std::string& name) { return nameMap.find(name)->second; };
+    auto registryByName = [](const std::string& name) { return FindTypeByName(name.c_str(), name.size()); };
+
+    ReportResult("unordered_map<string> (1 thread)", MeasureLookups(typeNames, 1, nameMapLookup));
+    ReportResult("FindTypeByName, not frozen (1 thread)", MeasureLookups(typeNames, 1, registryByName));
+
+    FreezeRegistry();
+
+    ReportResult("FindTypeByName, frozen (1 thread)", MeasureLookups(typeNames, 1, registryByName));
+
+    return 0;
+}
@@ -85,28 +85,28 @@ void PrintClassInfo(const Entropy::TypeInfo* typeInfo)
         const ClassDescription* classDesc = classInfo.GetClassDescription();
 
         const auto& classAttrs = classDesc->GetAllAttributes();
-        if (MapOps::GetCount(classAttrs) > 0)
+        if (!classAttrs.empty())
         {
             std::cout << "Attribute list for '" << typeInfo->GetTypeName() << "':" << std::endl;
-            for (const auto& kvp : classAttrs)
+            for (const AttributeData& attr : classAttrs)
             {
-                std::cout << "   Type: " << kvp.second.GetTypeInfo()->GetTypeName() << std::endl;
+                std::cout << "   Type: " << attr.GetTypeInfo()->GetTypeName() << std::endl;
             }
         }
 
         std::cout << "Member list for '" << typeInfo->GetTypeName() << "':" << std::endl;
-        for (const auto& memberKvp : classDesc->GetMembers())
+        for (const MemberDescription& member : classDesc->GetMembers())
         {
-            std::cout << "   " << memberKvp.first << " (" << memberKvp.second.GetMemberType()->GetTypeName() << ")"
+            std::cout << "   " << member.GetMemberName() << " (" << member.GetMemberType()->GetTypeName() << ")"
                       << std::endl;
 
-            const auto& memberAttrs = memberKvp.second.GetAllAttributes();
-            if (MapOps::GetCount(memberAttrs) > 0)
+            const auto& memberAttrs = member.GetAllAttributes();
+            if (!memberAttrs.empty())
             {
-                std::cout << "   Attribute list for member '" << memberKvp.first << "':" << std::endl;
-                for (const auto& kvp : memberAttrs)
+                std::cout << "   Attribute list for member '" << member.GetMemberName() << "':" << std::endl;
+                for (const AttributeData& attr : memberAttrs)
                 {
-                    std::cout << "      Type: " << kvp.second.GetTypeInfo()->GetTypeName() << std::endl;
+                    std::cout << "      Type: " << attr.GetTypeInfo()->GetTypeName() << std::endl;
                 }
             }
         }
@@ -10,6 +10,10 @@
 #include "Entropy/Reflection/Details/ReflectionMacros.h"
 
 #ifdef ENTROPY_RUNTIME_REFLECTION_ENABLED
+#include "Entropy/Reflection/DataObject/DataObjectArena.h"
+#include "Entropy/Reflection/DataObject/DataObjectVector.h"
+#include "Entropy/Reflection/TypeInfo/ReflectOnLoad.h"
 #include "Entropy/Reflection/TypeInfo/RuntimeReflectionMethods.h"
 #include "Entropy/Reflection/TypeInfo/TypeInfo.h"
+#include "Entropy/Reflection/TypeInfo/TypeInfoRegistry.h"
 #endif
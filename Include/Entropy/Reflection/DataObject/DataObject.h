@@ -7,13 +7,35 @@
 #include "Entropy/Core/Details/Defines.h"
 #include "Entropy/Reflection/TypeInfo/TypeInfoRef.h"
 #include <atomic>
+#include <cstddef>
+#include <type_traits>
 
 namespace Entropy
 {
 
 class DataObject;
+class DataObjectArena;
+class DataObjectVector;
+class DataObjectView;
+class UniqueDataObject;
 struct DataObjectFactory;
 
+/// <summary>
+/// How the owners of a DataObject payload keep count of each other.
+/// </summary>
+enum class DataObjectRefCountPolicy : byte
+{
+    /// <summary>
+    /// Copies may be made and released on any thread. Every copy does a locked increment.
+    /// </summary>
+    Atomic,
+
+    /// <summary>
+    /// Every copy is made and released on a single thread, so counting uses plain loads and stores.
+    /// </summary>
+    SingleThreaded
+};
+
 /// <summary>
 /// Wraps an arbitrary data object through type info. This can be treated like a smart pointer.
 /// </summary>
@@ -55,25 +77,102 @@ private:
         const void* operator()(const void*& data) const { return &data; }
     };
 
+    // Payloads up to this size (and alignment) are constructed inside the container instead of being allocated on their
+    // own, so creating them costs a single allocation. Only types that are trivially relocatable or nothrow move
+    // constructible are stored inline; others keep the co-allocated or separate storage.
+    static constexpr std::size_t cInlineStorageSize      = 24;
+    static constexpr std::size_t cInlineStorageAlignment = alignof(std::max_align_t);
+
+    enum class PayloadStorage : byte
+    {
+        Separate,    // Allocated on its own through the type info (or not owned at all when wrapped)
+        Inline,      // Lives in InlineDataObjectContainer::_inlineStorage
+        CoAllocated, // Lives in CoAllocatedDataObjectContainer<T>::_payload
+        Arena        // Lives right after an ArenaDataObjectContainer, owned by a DataObjectArena
+    };
+
+    // Plain and inline containers come from details::DataObjectContainerPool, so creating and releasing them does not
+    // go through the system allocator once the calling thread's pool is warm.
     struct DataObjectContainer
     {
         TypeInfoRef _typeInfo{};
         void* _data{};
         std::atomic_int _refCount{1};
-        DataPointerType _pointerType = DataPointerType::AddressOf;
-        bool _wrapped                = false;
+        DataPointerType _pointerType             = DataPointerType::AddressOf;
+        PayloadStorage _payloadStorage           = PayloadStorage::Separate;
+        DataObjectRefCountPolicy _refCountPolicy = DataObjectRefCountPolicy::Atomic;
+        bool _wrapped                            = false;
+        bool _copyOnWrite                        = false;
+    };
+
+    struct InlineDataObjectContainer : DataObjectContainer
+    {
+        typename std::aligned_storage<cInlineStorageSize, cInlineStorageAlignment>::type _inlineStorage;
+    };
+
+    // Allocated and freed by the type info of T (see details::HandleCoAllocation) so the control block and the payload
+    // share one allocation, like std::make_shared.
+    template <typename T>
+    struct CoAllocatedDataObjectContainer : DataObjectContainer
+    {
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type _payload;
+    };
+
+    // Lives in a DataObjectArena, which destructs the payload and frees the memory in one batch when it is reset
+    struct ArenaDataObjectContainer : DataObjectContainer
+    {
+        ArenaDataObjectContainer* _nextInArena = nullptr;
+        DataObjectArena* _arena                = nullptr;
     };
 
     DataObject(const TypeInfo* typeInfo, void* data, bool wrapped, DataPointerType pointerType);
 
+    /// <summary>
+    /// Allocates a container that has room for a payload of typeInfo's type: from the current DataObjectArena if there
+    /// is one, otherwise inline or co-allocated. Returns null if the payload has to be allocated separately.
+    /// </summary>
+    /// <remarks>
+    /// The storage for the payload is returned through payload. The caller constructs the payload there and then calls
+    /// SetPayloadConstructed(). Until then, releasing the returned object does not destruct anything.
+    /// </remarks>
+    static DataObject AllocateWithPayload(const TypeInfo* typeInfo, void*& payload);
+
+    inline void SetPayloadConstructed(void* payload) { _container->_data = payload; }
+
+    static void FreeContainer(DataObjectContainer* container);
+
+    /// <summary>
+    /// Destructs the payload (unless it is wrapped) and frees the container. Called once the last owner lets go.
+    /// </summary>
+    /// <remarks>
+    /// Arena containers are left alone; their arena destroys them when it is reset.
+    /// </remarks>
+    static void DestroyContainer(DataObjectContainer* container);
+
+    void AddRef();
     void Release();
 
+    /// <summary>
+    /// Gives this object its own copy of a copy-on-write payload if the payload is shared.
+    /// </summary>
+    void DetachIfShared();
+
 public:
     DataObject() = default;
     DataObject(std::nullptr_t);
     DataObject(const DataObject& other);
     DataObject(DataObject&& other) noexcept;
 
+    /// <summary>
+    /// Takes over the payload of a UniqueDataObject and starts counting references to it with the given policy.
+    /// </summary>
+    /// <remarks>
+    /// Use DataObjectRefCountPolicy::SingleThreaded only if this object and every copy of it stay on the current
+    /// thread.
+    /// </remarks>
+    explicit DataObject(UniqueDataObject&& unique,
+                        DataObjectRefCountPolicy refCountPolicy = DataObjectRefCountPolicy::Atomic);
+
     ~DataObject();
 
     /// <summary>
@@ -97,9 +196,17 @@ public:
     /// Casts the data into a usable type. This method does not have safety checks; check against null and use
     /// IsExactType<> or CanCastTo<> to check if the cast is safe.
     /// </summary>
+    /// <remarks>
+    /// If copy-on-write is enabled and the payload is shared, this first replaces it with a private copy.
+    /// </remarks>
     template <typename T>
     inline T& GetData()
     {
+        if (ENTROPY_UNLIKELY(_container->_copyOnWrite))
+        {
+            DetachIfShared();
+        }
+
         if (_container->_pointerType == DataPointerType::Direct)
         {
             return *reinterpret_cast<T*>(GetVoidPtr<true, T>{}(_container->_data));
@@ -138,15 +245,193 @@ public:
     DataObject& operator=(const DataObject& other);
     DataObject& operator=(DataObject&& other);
 
+    /// <summary>
+    /// Moves the payload into a UniqueDataObject if this is its only owner. Otherwise, null is returned and this object
+    /// is left untouched.
+    /// </summary>
+    UniqueDataObject TakeUnique();
+
+    DataObjectRefCountPolicy GetRefCountPolicy() const;
+
+    /// <summary>
+    /// Copy constructs the payload into a new DataObject that shares nothing with this one. Returns null if this is
+    /// null or the type cannot be copy constructed.
+    /// </summary>
+    /// <remarks>
+    /// Like any new object, the copy comes from the current DataObjectArena if there is one.
+    /// </remarks>
+    DataObject Clone() const;
+
+    /// <summary>
+    /// Lets this payload be shared by any number of copies until one of them asks for mutable access. The mutable
+    /// GetData<>() then gives that copy its own clone of the payload first, so the others never see the write.
+    /// </summary>
+    /// <remarks>
+    /// The mode belongs to the payload, so it applies to every existing copy of this object. Reads through the const
+    /// GetData<>() and DataObjectView never copy. Writes made through a reference obtained before a copy was made are
+    /// seen by that copy.
+    /// </remarks>
+    /// <returns>true if copy-on-write is enabled; false if the object is null, wrapped, or cannot be copied</returns>
+    bool EnableCopyOnWrite();
+
+    inline bool IsCopyOnWrite() const { return _container != nullptr && _container->_copyOnWrite; }
+
 private:
     bool CanCastTo(const TypeInfo* typeInfo) const;
 
     DataObjectContainer* _container{};
 
     friend class TypeInfo;
+    friend class UniqueDataObject;
+    friend class DataObjectArena;
+    friend class DataObjectView;
+    friend class DataObjectVector;
     friend struct DataObjectFactory;
 };
 
+/// <summary>
+/// Sole owner of a DataObject payload. It cannot be copied, so it never counts references.
+/// </summary>
+/// <remarks>
+/// Convert to a shared DataObject with the explicit DataObject(UniqueDataObject&&) constructor, and back with
+/// DataObject::TakeUnique().
+/// </remarks>
+class UniqueDataObject final
+{
+public:
+    UniqueDataObject() = default;
+    UniqueDataObject(std::nullptr_t) {}
+
+    UniqueDataObject(const UniqueDataObject&)            = delete;
+    UniqueDataObject& operator=(const UniqueDataObject&) = delete;
+
+    UniqueDataObject(UniqueDataObject&& other) noexcept
+        : _container(other._container)
+    {
+        other._container = nullptr;
+    }
+
+    UniqueDataObject& operator=(UniqueDataObject&& other) noexcept;
+
+    ~UniqueDataObject();
+
+    /// <summary>
+    /// See DataObject::GetData()
+    /// </summary>
+    template <typename T>
+    inline const T& GetData() const;
+
+    /// <summary>
+    /// See DataObject::GetData()
+    /// </summary>
+    template <typename T>
+    inline T& GetData();
+
+    inline const TypeInfo* GetTypeInfo() const
+    {
+        if (ENTROPY_LIKELY(_container))
+        {
+            return _container->_typeInfo;
+        }
+        return nullptr;
+    }
+
+    template <typename T>
+    inline bool IsExactType() const;
+
+    template <typename T>
+    inline bool CanCastTo() const;
+
+    /// <summary>
+    /// Destructs the payload now and leaves this object null.
+    /// </summary>
+    void Reset();
+
+    inline bool operator==(std::nullptr_t) const { return (_container == nullptr); }
+    inline bool operator!=(std::nullptr_t) const { return (_container != nullptr); }
+    inline operator bool() const { return _container != nullptr; }
+
+private:
+    bool CanCastTo(const TypeInfo* typeInfo) const;
+
+    DataObject::DataObjectContainer* _container{};
+
+    friend class DataObject;
+    friend class DataObjectView;
+};
+
+/// <summary>
+/// Non-owning reference to an object through its type info. It is trivially copyable and never allocates, which makes
+/// it the cheapest way to hand an existing object to code that works on type-erased data.
+/// </summary>
+/// <remarks>
+/// Like a raw pointer, a view keeps nothing alive and does not propagate constness. It must not outlive the object it
+/// refers to, nor the DataObject it was taken from.
+/// </remarks>
+class DataObjectView final
+{
+public:
+    DataObjectView() = default;
+    DataObjectView(std::nullptr_t) {}
+
+    DataObjectView(const DataObject& dataObject)
+    {
+        if (dataObject._container != nullptr)
+        {
+            _typeInfo    = dataObject._container->_typeInfo;
+            _data        = dataObject._container->_data;
+            _pointerType = dataObject._container->_pointerType;
+        }
+    }
+
+    DataObjectView(const UniqueDataObject& dataObject)
+    {
+        if (dataObject._container != nullptr)
+        {
+            _typeInfo    = dataObject._container->_typeInfo;
+            _data        = dataObject._container->_data;
+            _pointerType = dataObject._container->_pointerType;
+        }
+    }
+
+    /// <summary>
+    /// See DataObject::GetData()
+    /// </summary>
+    template <typename T>
+    inline T& GetData() const;
+
+    inline const TypeInfo* GetTypeInfo() const { return _typeInfo; }
+
+    template <typename T>
+    inline bool IsExactType() const;
+
+    template <typename T>
+    inline bool CanCastTo() const;
+
+    inline bool operator==(std::nullptr_t) const { return (_typeInfo == nullptr); }
+    inline bool operator!=(std::nullptr_t) const { return (_typeInfo != nullptr); }
+    inline operator bool() const { return _typeInfo != nullptr; }
+
+private:
+    DataObjectView(const TypeInfo* typeInfo, void* data, DataObject::DataPointerType pointerType) noexcept
+        : _typeInfo(typeInfo)
+        , _data(data)
+        , _pointerType(pointerType)
+    {
+    }
+
+    bool CanCastTo(const TypeInfo* typeInfo) const;
+
+    const TypeInfo* _typeInfo{};
+    void* _data{};
+    DataObject::DataPointerType _pointerType = DataObject::DataPointerType::AddressOf;
+
+    friend class DataObjectVector;
+    friend struct DataObjectFactory;
+};
+
+static_assert(std::is_trivially_copyable<DataObjectView>::value, "DataObjectView must stay trivially copyable");
+
 } // namespace Entropy
 
 #include "DataObject.inl"
@@ -29,4 +29,91 @@ inline bool DataObject::CanCastTo() const
     return false;
 }
 
+//================
+
+template <typename T>
+inline const T& UniqueDataObject::GetData() const
+{
+    if (_container->_pointerType == DataObject::DataPointerType::Direct)
+    {
+        return *reinterpret_cast<const T*>(DataObject::GetConstVoidPtr<true, T>{}(_container->_data));
+    }
+    else
+    {
+        return *reinterpret_cast<const T*>(DataObject::GetConstVoidPtr<false, T>{}(_container->_data));
+    }
+}
+
+template <typename T>
+inline T& UniqueDataObject::GetData()
+{
+    if (_container->_pointerType == DataObject::DataPointerType::Direct)
+    {
+        return *reinterpret_cast<T*>(DataObject::GetVoidPtr<true, T>{}(_container->_data));
+    }
+    else
+    {
+        return *reinterpret_cast<T*>(DataObject::GetVoidPtr<false, T>{}(_container->_data));
+    }
+}
+
+template <typename T>
+inline bool UniqueDataObject::IsExactType() const
+{
+    if (ENTROPY_LIKELY(_container))
+    {
+        return _container->_typeInfo == ReflectTypeAndGetTypeInfo<T>();
+    }
+    return false;
+}
+
+template <typename T>
+inline bool UniqueDataObject::CanCastTo() const
+{
+    if (ENTROPY_LIKELY(_container))
+    {
+        const TypeInfo* typeInfo = ReflectTypeAndGetTypeInfo<T>();
+        return CanCastTo(typeInfo);
+    }
+    return false;
+}
+
+//================
+
+template <typename T>
+inline T& DataObjectView::GetData() const
+{
+    // The view does not own the pointer it stores. For directly stored pointers, the reference points at that member.
+    void*& data = const_cast<void*&>(_data);
+    if (_pointerType == DataObject::DataPointerType::Direct)
+    {
+        return *reinterpret_cast<T*>(DataObject::GetVoidPtr<true, T>{}(data));
+    }
+    else
+    {
+        return *reinterpret_cast<T*>(DataObject::GetVoidPtr<false, T>{}(data));
+    }
+}
+
+template <typename T>
+inline bool DataObjectView::IsExactType() const
+{
+    if (ENTROPY_LIKELY(_typeInfo))
+    {
+        return _typeInfo == ReflectTypeAndGetTypeInfo<T>();
+    }
+    return false;
+}
+
+template <typename T>
+inline bool DataObjectView::CanCastTo() const
+{
+    if (ENTROPY_LIKELY(_typeInfo))
+    {
+        const TypeInfo* typeInfo = ReflectTypeAndGetTypeInfo<T>();
+        return CanCastTo(typeInfo);
+    }
+    return false;
+}
+
 } // namespace Entropy
@@ -0,0 +1,105 @@
+// Copyright (c) Entropy Software LLC
+// This file is licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+#pragma once
+
+#include "Entropy/Reflection/DataObject/DataObject.h"
+#include <cstddef>
+#include <type_traits>
+
+namespace Entropy
+{
+
+/// <summary>
+/// Bump allocator for DataObjects that share a lifetime, such as everything created while handling one request.
+///
+/// While a DataObjectArena::Scope is active on a thread, DataObjectFactory::Create<>() and TypeInfo::Construct*() place
+/// both the container and the payload in the arena. Releasing those DataObjects does nothing; the arena runs every
+/// destructor in one batch and frees its memory in one step when it is reset or destroyed.
+/// </summary>
+/// <remarks>
+/// Every DataObject created from the arena must be released before the arena is reset. Payloads too large for a
+/// single arena chunk, and over-aligned payloads, are allocated as usual. Wrapped objects never use the arena.
+///
+/// An arena is not thread safe. It should only be made current on one thread at a time.
+/// </remarks>
+class DataObjectArena final
+{
+public:
+    static constexpr std::size_t cChunkSize = 16 * 1024;
+
+    /// <summary>
+    /// Makes an arena current on this thread for as long as the scope is alive. Scopes can be nested; the previous
+    /// arena becomes current again when the scope ends.
+    /// </summary>
+    class Scope final
+    {
+    public:
+        explicit Scope(DataObjectArena& arena) noexcept;
+
+        /// <summary>
+        /// Makes no arena current, so objects created inside the scope are allocated as usual.
+        /// </summary>
+        explicit Scope(std::nullptr_t) noexcept;
+
+        ~Scope();
+
+        Scope(const Scope&)            = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        DataObjectArena* _previous = nullptr;
+    };
+
+    DataObjectArena() = default;
+    ~DataObjectArena();
+
+    DataObjectArena(const DataObjectArena&)            = delete;
+    DataObjectArena& operator=(const DataObjectArena&) = delete;
+
+    /// <summary>
+    /// Destructs every payload created from this arena, in reverse creation order, and frees all of its memory.
+    /// </summary>
+    void Reset();
+
+    /// <summary>
+    /// Returns the number of DataObjects created from this arena since it was last reset.
+    /// </summary>
+    inline std::size_t GetObjectCount() const { return _objectCount; }
+
+    /// <summary>
+    /// Returns the arena that is current on this thread, or null if there is none.
+    /// </summary>
+    static DataObjectArena* GetCurrent() noexcept;
+
+private:
+    struct Chunk
+    {
+        // Intentionally leaves the storage uninitialized
+        Chunk() {}
+
+        typename std::aligned_storage<cChunkSize, alignof(std::max_align_t)>::type storage;
+        Chunk* next = nullptr;
+    };
+
+    using ContainerType = DataObject::ArenaDataObjectContainer;
+
+    void* Allocate(std::size_t size, std::size_t alignment);
+
+    /// <summary>
+    /// Places a container followed by room for the payload in the arena. Returns null if the payload does not fit in a
+    /// chunk.
+    /// </summary>
+    DataObject::DataObjectContainer* AllocateContainer(std::size_t payloadSize, std::size_t payloadAlignment,
+                                                       void** payload);
+
+    Chunk* _chunks             = nullptr;
+    std::size_t _chunkOffset   = 0;
+    ContainerType* _containers = nullptr;
+    std::size_t _objectCount   = 0;
+
+    friend class DataObject;
+};
+
+} // namespace Entropy
@@ -0,0 +1,45 @@
+// Copyright (c) Entropy Software LLC
+// This file is licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+#pragma once
+
+#include <cstddef>
+
+namespace Entropy
+{
+namespace details
+{
+
+/// <summary>
+/// Thread-caching pool of fixed-size blocks that backs the DataObject containers that do not carry a co-allocated
+/// payload. Allocating and freeing a block is a pointer swap on the calling thread's free list.
+/// </summary>
+/// <remarks>
+/// A block may be freed on any thread. Each thread keeps at most 2 * cBatchSize free blocks and hands the excess back
+/// to a shared list in batches of cBatchSize, so producer / consumer threads only take a lock once per batch. A thread
+/// that runs dry takes a whole batch back from the shared list (or a new slab of cBatchSize blocks) in one step.
+///
+/// Blocks are never returned to the system allocator. A thread's cached blocks go back to the shared list when it
+/// exits.
+/// </remarks>
+class DataObjectContainerPool final
+{
+public:
+    static constexpr std::size_t cBlockSize      = 64;
+    static constexpr std::size_t cBlockAlignment = alignof(std::max_align_t);
+    static constexpr std::size_t cBatchSize      = 32;
+
+    /// <summary>
+    /// Returns an uninitialized block of cBlockSize bytes, or null if the system allocator is out of memory.
+    /// </summary>
+    static void* Allocate();
+
+    /// <summary>
+    /// Returns a block obtained from Allocate() to the pool. Can be called from any thread.
+    /// </summary>
+    static void Free(void* block) noexcept;
+};
+
+} // namespace details
+} // namespace Entropy
@@ -115,12 +115,42 @@ public:
         return typeInfo->DangerousMoveConstruct(static_cast<void*>(&move));
     }
 
+    /// <summary>
+    /// Same as Create<>(), but the object is returned with a sole owner that never counts references.
+    /// </summary>
+    template <typename T>
+    inline static UniqueDataObject CreateUnique()
+    {
+        return Create<T>().TakeUnique();
+    }
+
+    /// <summary>
+    /// Same as Create<>(const T&), but the object is returned with a sole owner that never counts references.
+    /// </summary>
+    template <typename T>
+    inline static UniqueDataObject CreateUnique(const T& copy)
+    {
+        return Create<T>(copy).TakeUnique();
+    }
+
+    /// <summary>
+    /// Same as Create<>(T&&), but the object is returned with a sole owner that never counts references.
+    /// </summary>
+    template <typename T>
+    inline static UniqueDataObject CreateUnique(T&& move)
+    {
+        return Create(std::forward<T>(move)).TakeUnique();
+    }
+
     /// <summary>
     /// Wraps a pointer to an existing object in a DataObject.
     /// </summary>
     /// <remarks>
     /// The value passed in is referenced, but never copied. It is extremely important that the DataObject not live
     /// passed the lifetime of the value.
+    ///
+    /// This still allocates a reference counted container. Use WrapView() when the reference does not need to be held
+    /// as a DataObject.
     /// </remarks>
     template <typename T>
     inline static DataObject Wrap(T&& value)
@@ -134,6 +164,19 @@ public:
         const TypeInfo* typeInfo = ReflectTypeAndGetTypeInfo<T>();
         return DataObject(typeInfo, ToVoid<T>{}(std::forward<T>(value)), true /* wrapped */, ToVoid<T>::PointerType);
     }
+
+    /// <summary>
+    /// Same as Wrap(), but returns a non-owning DataObjectView, which never allocates.
+    /// </summary>
+    /// <remarks>
+    /// The view must not live past the lifetime of the value.
+    /// </remarks>
+    template <typename T>
+    inline static DataObjectView WrapView(T&& value)
+    {
+        const TypeInfo* typeInfo = ReflectTypeAndGetTypeInfo<T>();
+        return DataObjectView(typeInfo, ToVoid<T>{}(std::forward<T>(value)), ToVoid<T>::PointerType);
+    }
 };
 
 } // namespace Entropy
@@ -0,0 +1,177 @@
+// Copyright (c) Entropy Software LLC
+// This file is licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+#pragma once
+
+#include "Entropy/Core/Details/VectorOps.h"
+#include "Entropy/Reflection/DataObject/DataObject.h"
+#include <cstddef>
+#include <type_traits>
+
+namespace Entropy
+{
+
+template <typename T>
+const TypeInfo* ReflectTypeAndGetTypeInfo() noexcept;
+
+/// <summary>
+/// Contiguous storage for any number of objects of a single type that is only known at runtime. Unlike holding one
+/// DataObject per value, the elements share one allocation and no control blocks, like a C array.
+/// </summary>
+/// <remarks>
+/// Elements are constructed, copied and destructed through the type info. Growing the storage and erasing elements
+/// relocate the elements that follow; trivially relocatable types are relocated with memcpy / memmove, other types
+/// are moved (or copied if they cannot be moved) one by one.
+///
+/// Element views and pointers are invalidated by anything that changes the capacity or moves elements. Over-aligned
+/// types are not supported.
+/// </remarks>
+class DataObjectVector final
+{
+public:
+    DataObjectVector() = default;
+    explicit DataObjectVector(const TypeInfo* typeInfo);
+
+    DataObjectVector(const DataObjectVector&)            = delete;
+    DataObjectVector& operator=(const DataObjectVector&) = delete;
+
+    DataObjectVector(DataObjectVector&& other) noexcept;
+    DataObjectVector& operator=(DataObjectVector&& other) noexcept;
+
+    ~DataObjectVector();
+
+    inline const TypeInfo* GetTypeInfo() const { return _typeInfo; }
+    inline std::size_t GetSize() const { return _size; }
+    inline std::size_t GetCapacity() const { return _capacity; }
+    inline bool IsEmpty() const { return _size == 0; }
+
+    /// <summary>
+    /// Makes room for at least capacity elements. The storage is allocated in blocks, so GetCapacity() may end up
+    /// larger than requested.
+    /// </summary>
+    /// <returns>true if there is room; false if the existing elements cannot be relocated or the type is not
+    /// supported</returns>
+    bool Reserve(std::size_t capacity);
+
+    /// <summary>
+    /// Default constructs a new element at the end.
+    /// </summary>
+    /// <returns>true if the element was added; false if the type cannot be default constructed</returns>
+    bool Emplace();
+
+    /// <summary>
+    /// Copies or moves value into a new element at the end. T must be the element type.
+    /// </summary>
+    /// <returns>true if the element was added; false if T is not the element type or cannot be copied / moved</returns>
+    template <typename T>
+    inline bool Push(T&& value);
+
+    /// <summary>
+    /// src _must_ be the same type as the elements and must not be an element of this vector.
+    /// </summary>
+    /// <remarks>
+    /// Use Push<> for the safe version
+    /// </remarks>
+    bool DangerousPushCopy(const void* src);
+
+    /// <summary>
+    /// src _must_ be the same type as the elements and must not be an element of this vector. src is left in its
+    /// moved-from state and still needs to be destructed.
+    /// </summary>
+    /// <remarks>
+    /// Use Push<> for the safe version
+    /// </remarks>
+    bool DangerousPushMove(void* src);
+
+    /// <summary>
+    /// Destructs the element at index and moves every element after it down by one.
+    /// </summary>
+    /// <returns>true if the element was erased; false if index is out of range or the elements cannot be
+    /// moved</returns>
+    bool Erase(std::size_t index);
+
+    /// <summary>
+    /// Destructs the last element. The vector must not be empty.
+    /// </summary>
+    void PopBack();
+
+    /// <summary>
+    /// Destructs every element. The capacity is kept.
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// Returns a view of the element at index. This method does not have bounds checks.
+    /// </summary>
+    inline DataObjectView operator[](std::size_t index) const
+    {
+        return DataObjectView(_typeInfo, GetElementPtr(index), DataObject::DataPointerType::AddressOf);
+    }
+
+    /// <summary>
+    /// Casts the element at index into a usable type. This method does not have safety or bounds checks.
+    /// </summary>
+    template <typename T>
+    inline const T& GetData(std::size_t index) const
+    {
+        return *reinterpret_cast<const T*>(GetElementPtr(index));
+    }
+
+    /// <summary>
+    /// Casts the element at index into a usable type. This method does not have safety or bounds checks.
+    /// </summary>
+    template <typename T>
+    inline T& GetData(std::size_t index)
+    {
+        return *reinterpret_cast<T*>(GetElementPtr(index));
+    }
+
+    inline void* GetElementPtr(std::size_t index) const
+    {
+        return reinterpret_cast<byte*>(const_cast<StorageBlock*>(&VectorOps::At(_storage, 0))) + (index * _elementSize);
+    }
+
+private:
+    /// <summary>
+    /// Unit of the raw element storage. Elements are laid out over the blocks without regard for block boundaries.
+    /// </summary>
+    struct alignas(std::max_align_t) StorageBlock
+    {
+        byte bytes[alignof(std::max_align_t)];
+    };
+
+    inline bool PushValue(const void* src, std::false_type /* move */) { return DangerousPushCopy(src); }
+    inline bool PushValue(void* src, std::true_type /* move */) { return DangerousPushMove(src); }
+
+    /// <summary>
+    /// Grows the storage if it is full and returns the uninitialized slot after the last element, or null if the
+    /// storage could not grow.
+    /// </summary>
+    void* PrepareBack();
+
+    TypeInfoRef _typeInfo{};
+    VectorOps::VectorType<StorageBlock> _storage{};
+    std::size_t _size          = 0;
+    std::size_t _capacity      = 0;
+    std::size_t _elementSize   = 0;
+    bool _triviallyRelocatable = false;
+};
+
+template <typename T>
+inline bool DataObjectVector::Push(T&& value)
+{
+    using ValueType = typename std::remove_reference<T>::type;
+
+    if (ENTROPY_UNLIKELY(ReflectTypeAndGetTypeInfo<typename std::remove_cv<ValueType>::type>() != _typeInfo))
+    {
+        return false;
+    }
+
+    // Rvalues are moved from, everything else is copied
+    using IsMove =
+        std::integral_constant<bool, !std::is_lvalue_reference<T>::value && !std::is_const<ValueType>::value>;
+    return PushValue(&value, IsMove{});
+}
+
+} // namespace Entropy
@@ -94,9 +94,33 @@ struct ReflectionMemberMetaData
     AttributeCollection<TAttrTypes...> attributes;
 };
 
+/// <summary>
+/// Class attribute that declares the class can be moved to new storage with memcpy, with the original storage then
+/// released without running its destructor. Trivially copyable types are always trivially relocatable and do not need
+/// this attribute.
+/// </summary>
+/// <remarks>
+/// Example: ENTROPY_REFLECT_CLASS(MyStruct, TriviallyRelocatable())
+/// </remarks>
+struct TriviallyRelocatable
+{
+};
+
 namespace details
 {
 
+template <typename TAttr, typename TAttrCollection>
+struct AttributeCollectionHasType : std::false_type
+{
+};
+
+template <typename TAttr, typename TFirstAttr, typename... TOtherAttrs>
+struct AttributeCollectionHasType<TAttr, AttributeCollection<TFirstAttr, TOtherAttrs...>>
+    : std::conditional<std::is_same<TAttr, typename std::decay<TFirstAttr>::type>::value, std::true_type,
+                       AttributeCollectionHasType<TAttr, AttributeCollection<TOtherAttrs...>>>::type
+{
+};
+
 template <typename... TTypes>
 constexpr AttributeCollection<TTypes...> MakeAttributeCollection(TTypes&&... vals)
 {
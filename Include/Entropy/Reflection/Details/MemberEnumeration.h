@@ -67,6 +67,12 @@ void ForEachReflectedClass(TFunc callbackObject)
 ///     (const char* memberName)
 ///   OR
 ///     (const char* memberName, Entropy::AttributeCollection<TAttrTypes...>&& attributes)
+///   OR
+///     (const char* memberName, int memberOffset, void* (*memberAccessor)(void*),
+///      Entropy::AttributeCollection<TAttrTypes...>&& attributes)
+///
+/// memberOffset is the byte offset of the member in its class, or -1 if the class is not standard layout.
+/// memberAccessor returns the address of the member given the address of a TClass object.
 /// </param>
 template <bool TIncludeSubclasses, typename TClass, typename TFunc>
 void ForEachReflectedMemberType(TFunc callbackObject)
@@ -165,11 +171,23 @@ struct ClassTypeOperation<TClass, TFunc, TIncludeSubclasses,
 
 //==================
 
+template <typename TMember, typename TFunc, typename... TMemberAttrs>
+inline typename std::enable_if<
+    Traits::IsClassMethodInvocable<TFunc, decltype(&TFunc::template operator()<TMember>), const char*, int,
+                                   void* (*)(void*), AttributeCollection<TMemberAttrs...>&&>::value>::
+    type InvokeMemberTypeFunction(ReflectionMemberMetaData<TMemberAttrs...>&& metaData, int memberOffset,
+                                  void* (*memberAccessor)(void*), TFunc callbackObj)
+{
+    callbackObj.template operator()<TMember>(metaData.memberName, memberOffset, memberAccessor,
+                                             std::move(metaData.attributes));
+}
+
 template <typename TMember, typename TFunc, typename... TMemberAttrs>
 inline typename std::enable_if<
     Traits::IsClassMethodInvocable<TFunc, decltype(&TFunc::template operator()<TMember>), const char*,
                                    AttributeCollection<TMemberAttrs...>&&>::value>::
-    type InvokeMemberTypeFunction(ReflectionMemberMetaData<TMemberAttrs...>&& metaData, TFunc callbackObj)
+    type InvokeMemberTypeFunction(ReflectionMemberMetaData<TMemberAttrs...>&& metaData, int memberOffset,
+                                  void* (*memberAccessor)(void*), TFunc callbackObj)
 {
     callbackObj.template operator()<TMember>(metaData.memberName, std::move(metaData.attributes));
 }
@@ -177,7 +195,8 @@ inline typename std::enable_if<
 template <typename TMember, typename TFunc, typename... TMemberAttrs>
 inline typename std::enable_if<
     Traits::IsClassMethodInvocable<TFunc, decltype(&TFunc::template operator()<TMember>), const char*>::value>::
-    type InvokeMemberTypeFunction(ReflectionMemberMetaData<TMemberAttrs...>&& metaData, TFunc callbackObj)
+    type InvokeMemberTypeFunction(ReflectionMemberMetaData<TMemberAttrs...>&& metaData, int memberOffset,
+                                  void* (*memberAccessor)(void*), TFunc callbackObj)
 {
     callbackObj(metaData.memberName);
 }
@@ -185,7 +204,8 @@ inline typename std::enable_if<
 template <typename TMember, typename TFunc, typename... TMemberAttrs>
 inline typename std::enable_if<
     Traits::IsClassMethodInvocable<TFunc, decltype(&TFunc::template operator()<TMember>)>::value>::
-    type InvokeMemberTypeFunction(ReflectionMemberMetaData<TMemberAttrs...>&& metaData, TFunc callbackObj)
+    type InvokeMemberTypeFunction(ReflectionMemberMetaData<TMemberAttrs...>&& metaData, int memberOffset,
+                                  void* (*memberAccessor)(void*), TFunc callbackObj)
 {
     callbackObj();
 }
@@ -4,6 +4,14 @@
 
 #pragma once
 
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+#ifdef ENTROPY_RUNTIME_REFLECTION_ENABLED
+#include "Entropy/Reflection/TypeInfo/ReflectOnLoad.h"
+#endif
+
 // This is a hack to get around an C++11 MSVC bug when using reflection with a template type.
 // The code will generate a partial specialization that will be similar to:
 //      struct __MemberTypeOperatorExists<MyType<T1>::__GetCounterValue<123>::value, ...
@@ -114,6 +122,40 @@
     struct MemberOffsetOf                                                                                              \
     {                                                                                                                  \
         static constexpr int Execute() { return -1; }                                                                  \
+        static void* GetMemberPtr(void* object) { return nullptr; }                                                    \
+    };
+
+// Only standard layout classes have well defined member offsets. Everything else (including reference and static
+// members) reports -1 and is reached through GetMemberPtr().
+#define ENTROPY_MEMBER_OFFSET_OF_FUNCTION(line, memberName)                                                            \
+    template <typename TDummy>                                                                                         \
+    struct MemberOffsetOfExists<ENTROPY_FAKE_INT_CONSTANT(ENTROPY_GET_COUNTER_VALUE(line)), TDummy>                    \
+        : public std::true_type                                                                                        \
+    {                                                                                                                  \
+    };                                                                                                                 \
+    template <typename TFunc, typename TThisType>                                                                      \
+    struct MemberOffsetOf<ENTROPY_FAKE_INT_CONSTANT(ENTROPY_GET_COUNTER_VALUE(line)), TFunc, TThisType>                \
+    {                                                                                                                  \
+        template <typename T>                                                                                          \
+        static constexpr int OffsetOf(                                                                                 \
+            typename std::enable_if<std::is_standard_layout<T>::value &&                                               \
+                                        std::is_member_object_pointer<decltype(&T::memberName)>::value,                \
+                                    int>::type)                                                                        \
+        {                                                                                                              \
+            return static_cast<int>(offsetof(T, memberName));                                                          \
+        }                                                                                                              \
+        template <typename T>                                                                                          \
+        static constexpr int OffsetOf(long)                                                                            \
+        {                                                                                                              \
+            return -1;                                                                                                 \
+        }                                                                                                              \
+        static constexpr int Execute() { return OffsetOf<TThisType>(0); }                                              \
+        /* Works for every class, so it is the accessor of choice when there is no offset */                           \
+        static void* GetMemberPtr(void* object)                                                                        \
+        {                                                                                                              \
+            return const_cast<void*>(                                                                                  \
+                static_cast<const void*>(std::addressof(static_cast<TThisType*>(object)->memberName)));                \
+        }                                                                                                              \
     };
 
 #define ENTROPY_NULL_MEMBER_OFFSET_OF_FUNCTION(line)                                                                   \
@@ -126,14 +168,26 @@
     struct MemberOffsetOf<ENTROPY_FAKE_INT_CONSTANT(ENTROPY_GET_COUNTER_VALUE(line)), TFunc, TThisType>                \
     {                                                                                                                  \
         static constexpr int Execute() { return -1; }                                                                  \
+        static void* GetMemberPtr(void* object) { return nullptr; }                                                    \
     };
 
 #define ENTROPY_START_CLASS_REFLECTION_REGISTRATION(className, ...)
 
+#ifndef ENTROPY_REFLECT_ON_LOAD
+#ifdef ENTROPY_RUNTIME_REFLECTION_ENABLED
+// Referencing the registrar from a member function (that is never called) instantiates it, which queues the class for
+// InitializeAllReflectedTypes() during static initialization. Members of class templates are only instantiated when
+// used, so template classes are never queued.
+#define ENTROPY_REFLECT_ON_LOAD(ClassName)                                                                             \
+    static bool __ReflectOnLoad() { return ::Entropy::details::ReflectOnLoadRegistrar<ClassName>::registered; }
+#else
 #define ENTROPY_REFLECT_ON_LOAD(ClassName)
+#endif
+#endif
 
 #define ENTROPY_REFLECT_OBJECT_CLASS(line, className, ...)                                                             \
-    using ThisReflectedType = className;                                                                               \
+    using ThisReflectedType     = className;                                                                           \
+    using __ClassAttributeTypes = decltype(::Entropy::details::MakeAttributeCollection(__VA_ARGS__));                  \
     ENTROPY_DECLARE_COUNTER(line)                                                                                      \
     ENTROPY_CLASS_TYPE_OPERATOR_FUNCTION({                                                                             \
         /* Note: the extra parens around src.memberName preserve the current const-ness of this object */              \
@@ -173,10 +227,16 @@
 #ifndef ENTROPY_REFLECT_MEMBER
 #define ENTROPY_REFLECT_MEMBER(memberName, ...)                                                                        \
     ENTROPY_DEFINE_LINE_MARKER(__LINE__)                                                                               \
+    ENTROPY_MEMBER_OFFSET_OF_FUNCTION(__LINE__, memberName)                                                            \
     ENTROPY_MEMBER_TYPE_OPERATOR_FUNCTION(__LINE__, {                                                                  \
         /* Note: the extra parens around src.memberName preserve the current const-ness of this object */              \
         ::Entropy::details::InvokeMemberTypeFunction<decltype((memberName)), TFunc>(                                   \
-            ::Entropy::details::MakeReflectionMemberMetaData(#memberName, ##__VA_ARGS__), callbackObj);                \
+            ::Entropy::details::MakeReflectionMemberMetaData(#memberName, ##__VA_ARGS__),                              \
+            MemberOffsetOf<ENTROPY_FAKE_INT_CONSTANT(ENTROPY_GET_COUNTER_VALUE(__LINE__)), TFunc,                      \
+                           ::Entropy::Traits::RemoveConstRef_t<TThisType>>::Execute(),                                 \
+            &MemberOffsetOf<ENTROPY_FAKE_INT_CONSTANT(ENTROPY_GET_COUNTER_VALUE(__LINE__)), TFunc,                     \
+                            ::Entropy::Traits::RemoveConstRef_t<TThisType>>::GetMemberPtr,                             \
+            callbackObj);                                                                                              \
     })                                                                                                                 \
     ENTROPY_UNARY_MEMBER_OPERATOR_FUNCTION(__LINE__, {                                                                 \
         /* Note: the extra parens around src.memberName preserve the current const-ness of this object */              \
@@ -6,6 +6,7 @@
 
 #include "Entropy/Core/Details/Defines.h"
 #include "Entropy/Core/Details/TypeTraits.h"
+#include "Entropy/Reflection/Details/AttributeCollection.h"
 
 namespace Entropy
 {
@@ -55,6 +56,39 @@ constexpr bool IsReflectedType_v = IsReflectedType<T>::value;
 
 //--------------
 
+/// <summary>
+/// True if T is a reflected class that declares TAttr as one of its own class attributes. Attributes are not inherited
+/// by subclasses.
+/// </summary>
+template <typename T, typename TAttr, typename = void>
+struct HasClassAttribute : std::false_type
+{
+};
+
+template <typename T, typename TAttr>
+struct HasClassAttribute<T, TAttr,
+                         typename std::enable_if<IsReflectedType<T>::value &&
+                                                 std::is_same<typename RemoveConstRef_t<T>::ThisReflectedType,
+                                                              RemoveConstRef_t<T>>::value>::type>
+    : ::Entropy::details::AttributeCollectionHasType<TAttr, typename RemoveConstRef_t<T>::__ClassAttributeTypes>
+{
+};
+
+/// <summary>
+/// True if T can be moved to new storage with memcpy and the old storage released without running the destructor.
+/// Classes opt in with the TriviallyRelocatable class attribute; this may also be specialized for types that cannot be
+/// reflected.
+/// </summary>
+template <typename T>
+struct IsTriviallyRelocatable
+    : std::integral_constant<bool, std::is_trivially_copyable<T>::value ||
+                                       HasClassAttribute<typename std::remove_all_extents<T>::type,
+                                                         ::Entropy::TriviallyRelocatable>::value>
+{
+};
+
+//--------------
+
 template <typename T, typename = void>
 struct IsAllocatorDestructible : public std::false_type
 {
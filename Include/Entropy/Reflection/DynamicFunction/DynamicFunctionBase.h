@@ -34,7 +34,7 @@ public:
 
     inline StringOps::StringType GetTypeName() const;
 
-    inline bool IsValid() const { return _dataObj; }
+    inline bool IsValid() const { return _dataView; }
 
     inline operator bool() const { return IsValid(); }
 
@@ -42,13 +42,16 @@ private:
     template <typename T, typename = void>
     struct MakeParam
     {
-        inline DataObject operator()(T&& param) const { return DataObjectFactory::Wrap<T>(std::forward<T>(param)); }
+        inline DataObjectView operator()(T&& param) const
+        {
+            return DataObjectFactory::WrapView<T>(std::forward<T>(param));
+        }
     };
 
     template <typename T>
     struct MakeParam<T, typename std::enable_if<std::is_same<T, void>::value>::type>
     {
-        inline DataObject operator()(...) const { return DataObject(nullptr); }
+        inline DataObjectView operator()(...) const { return DataObjectView(nullptr); }
     };
 
     template <typename T, typename = void>
@@ -56,13 +59,13 @@ private:
     {
         using TReturnValue = typename std::remove_reference<T>::type&;
 
-        inline DataObject operator()(T&& param) const { return MakeParam<TReturnValue>{}(param); }
+        inline DataObjectView operator()(T&& param) const { return MakeParam<TReturnValue>{}(param); }
     };
 
     template <typename T>
     struct MakeReturnValue<T, typename std::enable_if<std::is_same<T, void>::value>::type>
     {
-        inline DataObject operator()(...) const { return MakeParam<void>{}(nullptr); }
+        inline DataObjectView operator()(...) const { return MakeParam<void>{}(nullptr); }
     };
 
     template <typename T>
@@ -70,34 +73,35 @@ private:
     {
         using TReturnValue = typename std::remove_pointer<T>::type&;
 
-        inline DataObject operator()(T&& param) const
+        inline DataObjectView operator()(T&& param) const
         {
             // Remove the pointer for the return value
-            return DataObjectFactory::Wrap<TReturnValue>(&*param);
+            return DataObjectFactory::WrapView<TReturnValue>(&*param);
         }
     };
 
     template <typename T, bool TIsReturnValue>
     struct MakeDataObject
     {
-        inline DataObject operator()(T&& param) const { return MakeParam<T>{}(std::forward<T>(param)); }
+        inline DataObjectView operator()(T&& param) const { return MakeParam<T>{}(std::forward<T>(param)); }
     };
 
     template <typename T>
     struct MakeDataObject<T, true>
     {
-        inline DataObject operator()(T&& param) const { return MakeReturnValue<T>{}(std::forward<T>(param)); }
+        inline DataObjectView operator()(T&& param) const { return MakeReturnValue<T>{}(std::forward<T>(param)); }
     };
 
     template <bool TIsReturnValue, typename T>
     static DynamicFuncParam Create(T&& param);
 
-    DynamicFuncParam(DataObject&& dataObj)
-        : _dataObj(std::move(dataObj))
+    // Parameters only live for the duration of a call, so they reference the arguments without allocating
+    DynamicFuncParam(DataObjectView dataView)
+        : _dataView(dataView)
     {
     }
 
-    DataObject _dataObj{};
+    DataObjectView _dataView{};
 
     friend class DynamicFunctionBase;
 };
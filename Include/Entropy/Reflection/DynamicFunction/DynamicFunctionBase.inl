@@ -9,9 +9,9 @@ namespace details
 
 inline StringOps::StringType DynamicFuncParam::GetTypeName() const
 {
-    if (ENTROPY_LIKELY(_dataObj))
+    if (ENTROPY_LIKELY(_dataView))
     {
-        return _dataObj.GetTypeInfo()->GetTypeName();
+        return _dataView.GetTypeInfo()->GetTypeName();
     }
     else
     {
@@ -62,7 +62,7 @@ bool DynamicFunctionBase::IsReturnValueConvertible(const DynamicFuncParam& param
         return false;
     }
 
-    return (thisFnReturnTypeInfo == param._dataObj.GetTypeInfo());
+    return (thisFnReturnTypeInfo == param._dataView.GetTypeInfo());
 }
 
 template <typename T>
@@ -73,7 +73,7 @@ bool DynamicFunctionBase::IsParameterConvertible(const DynamicFuncParam& param)
         return false;
     }
 
-    return param._dataObj.CanCastTo<T>();
+    return param._dataView.CanCastTo<T>();
 }
 
 template <typename T, typename... TRest>
@@ -94,12 +94,11 @@ bool DynamicFunctionBase::AreParametersConvertible(const DynamicFuncParam* param
 template <std::size_t Index, class TArg>
 typename std::remove_reference<TArg>::type& DynamicFunctionBase::ConvertType(const DynamicFuncParam* param)
 {
-    auto actualParam     = (param + Index);
-    auto argTypeInfo     = ReflectTypeAndGetTypeInfo<typename std::remove_reference<TArg>::type>();
-    DataObject paramData = actualParam->_dataObj;
-    ENTROPY_ASSERT(paramData);
+    auto actualParam = (param + Index);
+    auto argTypeInfo = ReflectTypeAndGetTypeInfo<typename std::remove_reference<TArg>::type>();
+    ENTROPY_ASSERT(actualParam->_dataView);
 
-    return paramData.GetData<typename std::remove_reference<TArg>::type>();
+    return actualParam->_dataView.GetData<typename std::remove_reference<TArg>::type>();
 }
 
 template <typename TClass, typename ReturnValue, typename TCallFn, typename... Args>
@@ -0,0 +1,59 @@
+// Copyright (c) Entropy Software LLC
+// This file is licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+#pragma once
+
+#include "Entropy/Core/Details/FunctionTraits.h"
+#include <chrono>
+#include <cstddef>
+
+namespace Entropy
+{
+
+class TypeInfo;
+
+/// <summary>
+/// Called once per type drained by InitializeAllReflectedTypes() with the time it took to initialize the type.
+/// </summary>
+using ReflectedTypeInitializedHandler =
+    Traits::FunctionTraits<void(const TypeInfo*, std::chrono::nanoseconds)>::Function;
+
+/// <summary>
+/// Initializes every reflected class that registered itself at load time (see ENTROPY_REFLECT_CLASS) and has not been
+/// initialized through this method yet. Call this during startup so the first ReflectTypeAndGetTypeInfo<>() call for
+/// those types does not pay for filling the type info.
+/// </summary>
+/// <remarks>
+/// Only non-template classes register themselves. Types that register after this call (e.g. from a library loaded
+/// later) are picked up by the next call.
+///
+/// The handler is always called on the calling thread, after every type has been initialized.
+/// </remarks>
+/// <param name="threadCount">Number of threads to initialize the types on. Values below 2 run on the calling
+/// thread.</param>
+/// <param name="onTypeInitialized">Optional handler that receives the initialization time of each type</param>
+/// <returns>The number of types that were drained from the pending list</returns>
+std::size_t InitializeAllReflectedTypes(int threadCount = 1,
+                                        const ReflectedTypeInitializedHandler& onTypeInitialized = nullptr);
+
+namespace details
+{
+
+using ReflectOnLoadFunction = const TypeInfo* (*)();
+
+bool AddPendingReflectedType(ReflectOnLoadFunction reflectFn) noexcept;
+
+/// <summary>
+/// Adds T to the pending list during static initialization. The definition of registered lives with
+/// ReflectTypeAndGetTypeInfo<>() so it is only instantiated when runtime reflection is available.
+/// </summary>
+template <typename T>
+struct ReflectOnLoadRegistrar
+{
+    static const bool registered;
+};
+
+} // namespace details
+
+} // namespace Entropy
@@ -8,7 +8,12 @@
 #include "Entropy/Core/Details/TypeId.h"
 #include "Entropy/Reflection/Details/MemberEnumeration.h"
 #include "Entropy/Reflection/Details/TypeTraits.h"
+#include "ReflectOnLoad.h"
 #include "TypeInfo.h"
+#include "TypeInfoRegistry.h"
+#include <cstdint>
+#include <cstring>
+#include <new>
 
 namespace Entropy
 {
@@ -21,6 +26,32 @@ namespace details
 
 TypeInfo* CreateTypeInfo() noexcept;
 
+/// <summary>
+/// Marks the current thread as filling a type info for as long as the scope is alive. Scopes nest, so each thread
+/// keeps a stack of the type infos it is in the middle of filling.
+/// </summary>
+struct TypeInfoInitializationScope
+{
+    explicit TypeInfoInitializationScope(const TypeInfo* typeInfo) noexcept;
+    ~TypeInfoInitializationScope();
+
+    TypeInfoInitializationScope(const TypeInfoInitializationScope&)            = delete;
+    TypeInfoInitializationScope& operator=(const TypeInfoInitializationScope&) = delete;
+
+    /// <summary>
+    /// Returns true if the current thread is in the middle of filling typeInfo.
+    /// </summary>
+    static bool IsFilling(const TypeInfo* typeInfo) noexcept;
+
+    /// <summary>
+    /// Returns the most recently entered scope on the current thread, or null if it is not filling any type info.
+    /// </summary>
+    static const TypeInfoInitializationScope* GetInnermost() noexcept;
+
+    const TypeInfo* const typeInfo;
+    const TypeInfoInitializationScope* const outer;
+};
+
 template <typename TModule, typename TType, typename = void>
 struct FillModuleTypeClass
 {
@@ -141,7 +172,8 @@ struct FillModuleTypeClassMembers<TModule, TType, typename std::enable_if<Traits
         }
 
         template <typename TMember, typename... TAttrTypes>
-        void operator()(const char* memberName, AttributeCollection<TAttrTypes...>&& memberAttr)
+        void operator()(const char* memberName, int memberOffset, void* (*memberAccessor)(void*),
+                        AttributeCollection<TAttrTypes...>&& memberAttr)
         {
             // TMember is always a reference because we use decltype((member)) to preserve the const of the type. This
             // forces a reference too.
@@ -151,6 +183,14 @@ struct FillModuleTypeClassMembers<TModule, TType, typename std::enable_if<Traits
 
             _handler->template HandleClassMember<TMemberNoRef, TAttrTypes...>(*_module, memberName, typeInfo,
                                                                               std::move(memberAttr));
+
+            Entropy::Reflection::MemberLayout memberLayout;
+            memberLayout.offset    = memberOffset;
+            memberLayout.size      = sizeof(TMemberNoRef);
+            memberLayout.alignment = alignof(TMemberNoRef);
+            memberLayout.accessor  = memberAccessor;
+
+            _handler->template HandleClassMemberLayout<TMemberNoRef>(*_module, memberName, memberLayout);
         }
 
     private:
@@ -208,10 +248,24 @@ struct FillModuleTypes<TType, std::tuple<TFirstModule, TOtherModules...>>
 
 //------------------------
 
+// Value initializing these types is the same as zero filling their storage. Member pointers are excluded because their
+// null value is not all zero bits on every ABI.
+template <typename T>
+struct IsZeroConstructible
+    : std::integral_constant<bool, std::is_trivially_default_constructible<T>::value &&
+                                       std::is_trivially_copyable<T>::value &&
+                                       !std::is_member_pointer<typename std::remove_all_extents<T>::type>::value>
+{
+};
+
+//------------------------
+
 template <typename T, typename = void>
 struct HandleIsConstructible
 {
-    inline void operator()(TypeInfo* typeInfo) const {}
+    static constexpr TypeInfo::ConstructionHandler GetHandler() { return nullptr; }
+    static constexpr TypeInfo::ConstructAtHandler GetAtHandler() { return nullptr; }
+    static constexpr TypeInfo::ConstructNHandler GetNHandler() { return nullptr; }
 };
 
 template <typename T>
@@ -221,10 +275,28 @@ struct HandleIsConstructible<
 {
     using NonConstT = typename std::remove_const<T>::type;
 
-    inline void operator()(TypeInfo* typeInfo) const
+    static void* Construct() { return AllocatorOps::CreateInstance<NonConstT>(); }
+    static void ConstructAt(void* dst) { new (dst) NonConstT(); }
+
+    static void ConstructN(void* dst, std::size_t count)
     {
-        typeInfo->SetConstructionHandler([]() { return AllocatorOps::CreateInstance<NonConstT>(); });
+        if ENTROPY_CONSTEXPR (IsZeroConstructible<NonConstT>::value)
+        {
+            std::memset(dst, 0, count * sizeof(NonConstT));
+        }
+        else
+        {
+            NonConstT* elements = static_cast<NonConstT*>(dst);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                new (elements + i) NonConstT();
+            }
+        }
     }
+
+    static constexpr TypeInfo::ConstructionHandler GetHandler() { return &Construct; }
+    static constexpr TypeInfo::ConstructAtHandler GetAtHandler() { return &ConstructAt; }
+    static constexpr TypeInfo::ConstructNHandler GetNHandler() { return &ConstructN; }
 };
 
 //------------------------
@@ -232,7 +304,9 @@ struct HandleIsConstructible<
 template <typename T, typename = void>
 struct HandleIsCopyConstructible
 {
-    inline void operator()(TypeInfo* typeInfo) const {}
+    static constexpr TypeInfo::CopyConstructionHandler GetHandler() { return nullptr; }
+    static constexpr TypeInfo::CopyConstructAtHandler GetAtHandler() { return nullptr; }
+    static constexpr TypeInfo::CopyConstructNHandler GetNHandler() { return nullptr; }
 };
 
 template <typename T>
@@ -242,12 +316,33 @@ struct HandleIsCopyConstructible<
 {
     using NonConstT = typename std::remove_const<T>::type;
 
-    inline void operator()(TypeInfo* typeInfo) const
+    static void* CopyConstruct(const void* data)
+    {
+        return AllocatorOps::CreateInstance<NonConstT>(*reinterpret_cast<const T*>(data));
+    }
+
+    static void CopyConstructAt(void* dst, const void* src) { new (dst) NonConstT(*reinterpret_cast<const T*>(src)); }
+
+    static void CopyConstructN(void* dst, const void* src, std::size_t count)
     {
-        typeInfo->SetCopyConstructionHandler([](const void* data) {
-            return AllocatorOps::CreateInstance<NonConstT>(*reinterpret_cast<const T*>(data));
-        });
+        if ENTROPY_CONSTEXPR (std::is_trivially_copyable<NonConstT>::value)
+        {
+            std::memcpy(dst, src, count * sizeof(NonConstT));
+        }
+        else
+        {
+            NonConstT* dstElements       = static_cast<NonConstT*>(dst);
+            const NonConstT* srcElements = static_cast<const NonConstT*>(src);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                new (dstElements + i) NonConstT(srcElements[i]);
+            }
+        }
     }
+
+    static constexpr TypeInfo::CopyConstructionHandler GetHandler() { return &CopyConstruct; }
+    static constexpr TypeInfo::CopyConstructAtHandler GetAtHandler() { return &CopyConstructAt; }
+    static constexpr TypeInfo::CopyConstructNHandler GetNHandler() { return &CopyConstructN; }
 };
 
 //------------------------
@@ -255,7 +350,9 @@ struct HandleIsCopyConstructible<
 template <typename T, typename = void>
 struct HandleIsMoveConstructible
 {
-    inline void operator()(TypeInfo* typeInfo) const {}
+    static constexpr TypeInfo::MoveConstructionHandler GetHandler() { return nullptr; }
+    static constexpr TypeInfo::MoveConstructAtHandler GetAtHandler() { return nullptr; }
+    static constexpr TypeInfo::MoveConstructNHandler GetNHandler() { return nullptr; }
 };
 
 template <typename T>
@@ -265,12 +362,36 @@ struct HandleIsMoveConstructible<
 {
     using NonConstT = typename std::remove_const<T>::type;
 
-    inline void operator()(TypeInfo* typeInfo) const
+    static void* MoveConstruct(void* data)
     {
-        typeInfo->SetMoveConstructionHandler([](void* data) {
-            return AllocatorOps::CreateInstance<NonConstT>(std::move(*reinterpret_cast<NonConstT*>(data)));
-        });
+        return AllocatorOps::CreateInstance<NonConstT>(std::move(*reinterpret_cast<NonConstT*>(data)));
     }
+
+    static void MoveConstructAt(void* dst, void* src)
+    {
+        new (dst) NonConstT(std::move(*reinterpret_cast<NonConstT*>(src)));
+    }
+
+    static void MoveConstructN(void* dst, void* src, std::size_t count)
+    {
+        if ENTROPY_CONSTEXPR (std::is_trivially_copyable<NonConstT>::value)
+        {
+            std::memcpy(dst, src, count * sizeof(NonConstT));
+        }
+        else
+        {
+            NonConstT* dstElements = static_cast<NonConstT*>(dst);
+            NonConstT* srcElements = static_cast<NonConstT*>(src);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                new (dstElements + i) NonConstT(std::move(srcElements[i]));
+            }
+        }
+    }
+
+    static constexpr TypeInfo::MoveConstructionHandler GetHandler() { return &MoveConstruct; }
+    static constexpr TypeInfo::MoveConstructAtHandler GetAtHandler() { return &MoveConstructAt; }
+    static constexpr TypeInfo::MoveConstructNHandler GetNHandler() { return &MoveConstructN; }
 };
 
 //------------------------
@@ -278,7 +399,9 @@ struct HandleIsMoveConstructible<
 template <typename T, typename = void>
 struct HandleIsDestructible
 {
-    inline void operator()(TypeInfo* typeInfo) const {}
+    static constexpr TypeInfo::DestructionHandler GetHandler() { return nullptr; }
+    static constexpr TypeInfo::DestructAtHandler GetAtHandler() { return nullptr; }
+    static constexpr TypeInfo::DestructNHandler GetNHandler() { return nullptr; }
 };
 
 template <typename T>
@@ -291,50 +414,209 @@ struct HandleIsDestructible<
 {
     using NonConstT = typename std::remove_const<T>::type;
 
-    inline void operator()(TypeInfo* typeInfo) const
+    static void Destruct(void* dataPtr) { AllocatorOps::DestroyInstance(reinterpret_cast<NonConstT*>(dataPtr)); }
+    static void DestructAt(void* dataPtr) { reinterpret_cast<NonConstT*>(dataPtr)->~NonConstT(); }
+
+    static void DestructN(void* dataPtr, std::size_t count)
+    {
+        NonConstT* elements = static_cast<NonConstT*>(dataPtr);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            elements[i].~NonConstT();
+        }
+    }
+
+    static constexpr TypeInfo::DestructionHandler GetHandler() { return &Destruct; }
+    static constexpr TypeInfo::DestructAtHandler GetAtHandler() { return &DestructAt; }
+
+    // Trivially destructible types get no handler so destroying a range of them is skipped entirely
+    static constexpr TypeInfo::DestructNHandler GetNHandler()
     {
-        typeInfo->SetDestructionHandler(
-            [](void* dataPtr) { AllocatorOps::DestroyInstance(reinterpret_cast<NonConstT*>(dataPtr)); });
+        return std::is_trivially_destructible<NonConstT>::value ? nullptr : &DestructN;
     }
 };
 
-template <typename TType>
-struct FillCommonTypeInfo
+//------------------------
+
+// Over-aligned types are left out because the allocator is only guaranteed to align to max_align_t
+template <typename T, typename = void>
+struct HandleCoAllocation
 {
-    void operator()(TypeInfo* typeInfo) const
-    {
-        typeInfo->SetTypeName(MakeTypeName<TType>{}());
-        typeInfo->SetTypeId(Traits::TypeIdOf<TType>{}());
+    static constexpr TypeInfo::AllocateContainerHandler GetAllocateHandler() { return nullptr; }
+    static constexpr TypeInfo::FreeContainerHandler GetFreeHandler() { return nullptr; }
+};
 
-        HandleIsConstructible<TType>{}(typeInfo);
-        HandleIsCopyConstructible<TType>{}(typeInfo);
-        HandleIsMoveConstructible<TType>{}(typeInfo);
-        HandleIsDestructible<TType>{}(typeInfo);
+template <typename T>
+struct HandleCoAllocation<
+    T, typename std::enable_if<(HandleIsDestructible<T>::GetAtHandler() != nullptr) &&
+                               (alignof(typename std::remove_const<T>::type) <= alignof(std::max_align_t))>::type>
+{
+    using ContainerType = TypeInfo::CoAllocatedDataObjectContainer<typename std::remove_const<T>::type>;
 
-        if ENTROPY_CONSTEXPR (std::is_const<TType>::value)
+    static TypeInfo::DataObjectContainer* AllocateContainer(void** payload)
+    {
+        ContainerType* container = AllocatorOps::CreateInstance<ContainerType>();
+        if (ENTROPY_LIKELY(container != nullptr))
         {
-            typeInfo->SetIsConst();
+            *payload = &container->_payload;
         }
+        return container;
+    }
 
-        if ENTROPY_CONSTEXPR (std::is_pointer<TType>::value)
-        {
-            typeInfo->SetIsPointer();
-        }
+    static void FreeContainer(TypeInfo::DataObjectContainer* container)
+    {
+        AllocatorOps::DestroyInstance(static_cast<ContainerType*>(container));
+    }
 
-        if ENTROPY_CONSTEXPR (std::is_lvalue_reference<TType>::value)
-        {
-            typeInfo->SetIsLReference();
-        }
+    static constexpr TypeInfo::AllocateContainerHandler GetAllocateHandler() { return &AllocateContainer; }
+    static constexpr TypeInfo::FreeContainerHandler GetFreeHandler() { return &FreeContainer; }
+};
 
-        if ENTROPY_CONSTEXPR (std::is_rvalue_reference<TType>::value)
-        {
-            typeInfo->SetIsRReference();
-        }
+//------------------------
 
-        if ENTROPY_CONSTEXPR (std::is_array<TType>::value)
-        {
-            typeInfo->SetIsArray();
-        }
+template <typename TType>
+struct TypeOpsOf
+{
+    static constexpr TypeInfo::TypeOps value{
+        HandleIsConstructible<TType>::GetHandler(),       HandleIsCopyConstructible<TType>::GetHandler(),
+        HandleIsMoveConstructible<TType>::GetHandler(),   HandleIsDestructible<TType>::GetHandler(),
+        HandleIsConstructible<TType>::GetAtHandler(),     HandleIsCopyConstructible<TType>::GetAtHandler(),
+        HandleIsMoveConstructible<TType>::GetAtHandler(), HandleIsDestructible<TType>::GetAtHandler(),
+        HandleIsConstructible<TType>::GetNHandler(),      HandleIsCopyConstructible<TType>::GetNHandler(),
+        HandleIsMoveConstructible<TType>::GetNHandler(),  HandleIsDestructible<TType>::GetNHandler(),
+        HandleCoAllocation<TType>::GetAllocateHandler(),  HandleCoAllocation<TType>::GetFreeHandler()};
+};
+
+template <typename TType>
+constexpr TypeInfo::TypeOps TypeOpsOf<TType>::value;
+
+//------------------------
+
+// Types without storage of their own (references, void, functions, unbounded arrays) and incomplete types report a size
+// and alignment of 0, and none of the type traits. The standard traits must not be queried for incomplete types.
+template <typename TType, typename = void>
+struct TypeLayoutOf
+{
+    static constexpr std::size_t size      = 0;
+    static constexpr std::size_t alignment = 0;
+
+    static constexpr bool isTriviallyCopyable     = false;
+    static constexpr bool isTriviallyDestructible = false;
+    static constexpr bool isStandardLayout        = false;
+    static constexpr bool isTriviallyRelocatable  = false;
+    static constexpr bool isEmpty                 = false;
+
+    static constexpr bool isNothrowMoveConstructible = false;
+};
+
+template <typename TType>
+struct TypeLayoutOf<TType, typename std::enable_if<std::is_object<TType>::value && (sizeof(TType) > 0)>::type>
+{
+    static constexpr std::size_t size      = sizeof(TType);
+    static constexpr std::size_t alignment = alignof(TType);
+
+    static constexpr bool isTriviallyCopyable     = std::is_trivially_copyable<TType>::value;
+    static constexpr bool isTriviallyDestructible = std::is_trivially_destructible<TType>::value;
+    static constexpr bool isStandardLayout        = std::is_standard_layout<TType>::value;
+    static constexpr bool isTriviallyRelocatable  = Traits::IsTriviallyRelocatable<TType>::value;
+    static constexpr bool isEmpty                 = std::is_empty<TType>::value;
+
+    static constexpr bool isNothrowMoveConstructible = std::is_nothrow_move_constructible<TType>::value;
+};
+
+// One level of a qualifier signature. A level can be both const and a pointer / array, e.g. int* const.
+static constexpr std::uint64_t cQualifierLevelConst     = 1 << 0;
+static constexpr std::uint64_t cQualifierLevelPointer   = 1 << 1;
+static constexpr std::uint64_t cQualifierLevelArray     = 1 << 2;
+static constexpr std::uint64_t cQualifierLevelReference = 1 << 3;
+static constexpr std::uint64_t cQualifierLevelMask      = 0xF;
+static constexpr std::uint64_t cQualifierLevelBits      = 4;
+static constexpr int cQualifierMaxLevels                = 64 / cQualifierLevelBits;
+
+// Marks a chain with more than cQualifierMaxLevels levels. It has every bit set, which no real chain can have.
+static constexpr std::uint64_t cQualifierSignatureOverflow = ~std::uint64_t(0);
+
+template <typename TType>
+struct QualifierLevelOf
+{
+    static constexpr std::uint64_t value = (std::is_const<TType>::value ? cQualifierLevelConst : 0) |
+                                           (std::is_pointer<TType>::value ? cQualifierLevelPointer : 0) |
+                                           (std::is_array<TType>::value ? cQualifierLevelArray : 0) |
+                                           (std::is_reference<TType>::value ? cQualifierLevelReference : 0);
+};
+
+/// <summary>
+/// Compile time copy of the qualifier chain FillCommonTypeInfo() builds out of next unqualified types. Every level
+/// removes the same qualifiers, so level N of the signature describes the type info N steps down the chain.
+/// </summary>
+template <typename TType, typename = void>
+struct QualifierChainOf
+{
+    using BaseType = TType;
+
+    static constexpr int depth               = 0;
+    static constexpr std::uint64_t signature = 0;
+};
+
+template <typename TType>
+struct QualifierChainOf<TType, typename std::enable_if<(QualifierLevelOf<TType>::value != 0)>::type>
+{
+private:
+    using NextType = typename std::conditional<
+        std::is_reference<TType>::value, typename std::remove_reference<TType>::type,
+        typename std::conditional<
+            std::is_pointer<TType>::value, typename std::remove_pointer<TType>::type,
+            typename std::conditional<std::is_array<TType>::value,
+                                      typename std::remove_extent<typename std::remove_const<TType>::type>::type,
+                                      typename std::remove_const<TType>::type>::type>::type>::type;
+
+    using NextChain = QualifierChainOf<NextType>;
+
+public:
+    using BaseType = typename NextChain::BaseType;
+
+    static constexpr int depth               = NextChain::depth + 1;
+    static constexpr std::uint64_t signature = depth > cQualifierMaxLevels
+                                                   ? cQualifierSignatureOverflow
+                                                   : (QualifierLevelOf<TType>::value |
+                                                      (NextChain::signature << cQualifierLevelBits));
+};
+
+template <typename TType>
+struct TypeInfoCoreDataOf
+{
+private:
+    using Flags = TypeInfo::Flags;
+
+public:
+    static constexpr TypeInfo::CoreData value{
+        (std::is_const<TType>::value ? Flags::IsConst : Flags::None) |
+        (std::is_pointer<TType>::value ? Flags::IsPointer : Flags::None) |
+        (std::is_lvalue_reference<TType>::value ? Flags::IsLReference : Flags::None) |
+        (std::is_rvalue_reference<TType>::value ? Flags::IsRReference : Flags::None) |
+        (std::is_array<TType>::value ? Flags::IsArray : Flags::None) |
+        (TypeLayoutOf<TType>::isTriviallyCopyable ? Flags::IsTriviallyCopyable : Flags::None) |
+        (TypeLayoutOf<TType>::isTriviallyDestructible ? Flags::IsTriviallyDestructible : Flags::None) |
+        (TypeLayoutOf<TType>::isStandardLayout ? Flags::IsStandardLayout : Flags::None) |
+        (TypeLayoutOf<TType>::isTriviallyRelocatable ? Flags::IsTriviallyRelocatable : Flags::None) |
+        (TypeLayoutOf<TType>::isEmpty ? Flags::IsEmpty : Flags::None) |
+        (TypeLayoutOf<TType>::isNothrowMoveConstructible ? Flags::IsNothrowMoveConstructible : Flags::None),
+        TypeLayoutOf<TType>::size, TypeLayoutOf<TType>::alignment, QualifierChainOf<TType>::signature};
+};
+
+template <typename TType>
+constexpr TypeInfo::CoreData TypeInfoCoreDataOf<TType>::value;
+
+template <typename TType>
+struct FillCommonTypeInfo
+{
+    void operator()(TypeInfo* typeInfo) const
+    {
+        typeInfo->SetTypeName(MakeTypeName<TType>{}());
+        typeInfo->SetTypeId(Traits::TypeIdOf<TType>{}());
+        typeInfo->SetCoreData(&TypeInfoCoreDataOf<TType>::value);
+
+        typeInfo->SetTypeOps(&TypeOpsOf<TType>::value);
 
         if ENTROPY_CONSTEXPR (!Traits::IsUnqualifiedType<TType>::value)
         {
@@ -372,6 +654,9 @@ struct FillCommonTypeInfo
                 const TypeInfo* unqualifiedType = ReflectTypeAndGetTypeInfo<typename std::remove_const<TType>::type>();
                 typeInfo->SetNextUnqualifiedType(unqualifiedType);
             }
+
+            typeInfo->SetFullyUnqualifiedType(
+                ReflectTypeAndGetTypeInfo<typename QualifierChainOf<TType>::BaseType>());
         }
     }
 };
@@ -388,14 +673,34 @@ const TypeInfo* ReflectTypeAndGetTypeInfo() noexcept
     // template parameter processing. By separating the allocation from the initialization, we avoid the hang during
     // this re-entrant call. Instead of a hang, the base type will be given a partially initialized Derived type info as
     // the template parameter.
+    //
+    // Once a type info is ready, callers only pay for an acquire load. Any other caller waits for the initializing
+    // thread to finish, so it never sees a partially filled type info. Only the thread that is filling the type info
+    // itself skips the wait, which keeps the re-entrant behavior above. When two threads fill types that refer to each
+    // other, waiting would deadlock; that cycle is detected and the thread that notices it continues like a re-entrant
+    // call (see TypeInfo::WaitForInitialization()).
 
     static TypeInfo* typeInfo = details::CreateTypeInfo();
     static TypeInfoRef typeInfoRef(typeInfo);
 
-    if (ENTROPY_UNLIKELY(typeInfo->RequireInitialization()))
+    if (ENTROPY_UNLIKELY(!typeInfo->IsInitialized()))
     {
-        details::FillCommonTypeInfo<T>{}(typeInfo);
-        details::FillModuleTypes<T, TypeInfo::ModuleTypes>{}(typeInfo);
+        if (typeInfo->BeginInitialization())
+        {
+            details::TypeInfoInitializationScope initScope(typeInfo);
+
+            details::FillCommonTypeInfo<T>{}(typeInfo);
+            details::FillModuleTypes<T, TypeInfo::ModuleTypes>{}(typeInfo);
+
+            typeInfo->FinishInitialization();
+
+            // Only fully filled type infos can be found through FindTypeById() / FindTypeByName()
+            details::RegisterTypeInfo(typeInfo);
+        }
+        else
+        {
+            typeInfo->WaitForInitialization();
+        }
     }
 
     return typeInfo;
@@ -407,4 +712,12 @@ void ReflectType()
     ReflectTypeAndGetTypeInfo<T>();
 }
 
+namespace details
+{
+
+template <typename T>
+const bool ReflectOnLoadRegistrar<T>::registered = AddPendingReflectedType(&ReflectTypeAndGetTypeInfo<T>);
+
+} // namespace details
+
 } // namespace Entropy
@@ -11,6 +11,7 @@
 #include "Entropy/Reflection/TypeInfo/TypeInfoModuleList.h"
 #include "Entropy/Reflection/TypeInfo/TypeInfoRef.h"
 #include <atomic>
+#include <cstdint>
 
 namespace Entropy
 {
@@ -20,6 +21,12 @@ namespace details
 template <typename>
 struct FillCommonTypeInfo;
 
+template <typename>
+struct TypeInfoCoreDataOf;
+
+template <typename>
+struct TypeOpsOf;
+
 template <typename, typename>
 struct HandleIsConstructible;
 
@@ -31,6 +38,9 @@ struct HandleIsMoveConstructible;
 
 template <typename, typename>
 struct HandleIsDestructible;
+
+template <typename, typename>
+struct HandleCoAllocation;
 } // namespace details
 
 class DataObject;
@@ -52,6 +62,14 @@ class TypeInfo final
         IsLReference = 1 << 2,
         IsRReference = 1 << 3,
         IsArray      = 1 << 4, // Static allocated array. (e.g. char[4])
+
+        IsTriviallyCopyable     = 1 << 5,
+        IsTriviallyDestructible = 1 << 6,
+        IsStandardLayout        = 1 << 7,
+        IsTriviallyRelocatable  = 1 << 8,
+        IsEmpty                 = 1 << 9,
+
+        IsNothrowMoveConstructible = 1 << 10,
     };
     friend inline constexpr Flags operator|(Flags x, Flags y)
     {
@@ -71,14 +89,83 @@ class TypeInfo final
     }
     // NOLINTEND(clang-analyzer-optin.core.EnumCastOutOfRange)
 
+    /// <summary>
+    /// The part of a type info that is fully known at compile time. Exactly one constexpr instance exists per type
+    /// (see details::TypeInfoCoreDataOf), so it lives in read-only memory and is shared instead of being filled at
+    /// runtime.
+    /// </summary>
+    /// <remarks>
+    /// The type name and TypeId are not part of it. They are set when the type is first reflected.
+    /// </remarks>
+    struct CoreData
+    {
+        Flags flags;
+        std::size_t size;
+        std::size_t alignment;
+
+        // The whole qualifier chain, one level per 4 bits with the outermost level in the lowest bits (see
+        // details::QualifierChainOf). Unqualified types have no levels at all.
+        std::uint64_t qualifiers;
+    };
+
+    static constexpr CoreData cEmptyCoreData{Flags::None, 0, 0, 0};
+
 public:
     using ModuleTypes = Reflection::TypeInfoModuleTraits::ModuleTypes;
 
 private:
-    using ConstructionHandler     = Traits::FunctionTraits<void*()>::Function;
-    using CopyConstructionHandler = Traits::FunctionTraits<void*(const void*)>::Function;
-    using MoveConstructionHandler = Traits::FunctionTraits<void*(void*)>::Function;
-    using DestructionHandler      = Traits::FunctionTraits<void(void*)>::Function;
+    using ConstructionHandler     = void* (*)();
+    using CopyConstructionHandler = void* (*)(const void*);
+    using MoveConstructionHandler = void* (*)(void*);
+    using DestructionHandler      = void (*)(void*);
+
+    using ConstructAtHandler     = void (*)(void*);
+    using CopyConstructAtHandler = void (*)(void*, const void*);
+    using MoveConstructAtHandler = void (*)(void*, void*);
+    using DestructAtHandler      = void (*)(void*);
+
+    using ConstructNHandler     = void (*)(void*, std::size_t);
+    using CopyConstructNHandler = void (*)(void*, const void*, std::size_t);
+    using MoveConstructNHandler = void (*)(void*, void*, std::size_t);
+    using DestructNHandler      = void (*)(void*, std::size_t);
+
+    using DataObjectContainer = DataObject::DataObjectContainer;
+
+    template <typename T>
+    using CoAllocatedDataObjectContainer = DataObject::CoAllocatedDataObjectContainer<T>;
+
+    using AllocateContainerHandler = DataObjectContainer* (*)(void** payload);
+    using FreeContainerHandler     = void (*)(DataObjectContainer*);
+
+    /// <summary>
+    /// Construction and destruction entry points for a type. Exactly one constexpr table exists per type (see
+    /// details::TypeOpsOf), so every type info shares it instead of holding its own type-erased callables. A handler is
+    /// null if the type does not support the operation.
+    /// </summary>
+    struct TypeOps
+    {
+        ConstructionHandler construct;
+        CopyConstructionHandler copyConstruct;
+        MoveConstructionHandler moveConstruct;
+        DestructionHandler destruct;
+
+        ConstructAtHandler constructAt;
+        CopyConstructAtHandler copyConstructAt;
+        MoveConstructAtHandler moveConstructAt;
+        DestructAtHandler destructAt;
+
+        ConstructNHandler constructN;
+        CopyConstructNHandler copyConstructN;
+        MoveConstructNHandler moveConstructN;
+        DestructNHandler destructN; // Also null for trivially destructible types, which need no destruction
+
+        // Allocate / free a DataObject container with room for the payload (see DataObject::AllocateWithPayload)
+        AllocateContainerHandler allocateContainer;
+        FreeContainerHandler freeContainer;
+    };
+
+    static constexpr TypeOps cEmptyTypeOps{nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+                                           nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr};
 
     template <typename TModule, typename TModuleTypes, std::size_t Index = 0>
     struct ModuleIndexHelper;
@@ -138,6 +225,91 @@ public:
     /// </remarks>
     DataObject DangerousMoveConstruct(void* src) const;
 
+    /// <summary>
+    /// Returns sizeof() the type, or 0 if the type has no storage of its own (references, void, functions, unbounded
+    /// arrays and incomplete types).
+    /// </summary>
+    std::size_t GetSize() const;
+
+    /// <summary>
+    /// Returns alignof() the type, or 0 if GetSize() is 0.
+    /// </summary>
+    std::size_t GetAlignment() const;
+
+    /// <summary>
+    /// Default constructs the type in place. dst must point to at least GetSize() bytes aligned to GetAlignment().
+    /// </summary>
+    /// <remarks>
+    /// The caller owns the object and must call DestructAt() before releasing the memory.
+    /// </remarks>
+    /// <returns>true if the object was constructed; false if the type cannot be default constructed</returns>
+    bool ConstructAt(void* dst) const;
+
+    /// <summary>
+    /// Copy constructs the type in place. See ConstructAt() for the requirements on dst.
+    /// </summary>
+    /// <remarks>
+    /// src _must_ be the same type as what is being represented by this type info.
+    /// </remarks>
+    /// <returns>true if the object was constructed; false if the type cannot be copy constructed</returns>
+    bool CopyConstructAt(void* dst, const void* src) const;
+
+    /// <summary>
+    /// Move constructs the type in place. See ConstructAt() for the requirements on dst.
+    /// </summary>
+    /// <remarks>
+    /// src _must_ be the same type as what is being represented by this type info. src is left in its moved-from state
+    /// and still needs to be destructed.
+    /// </remarks>
+    /// <returns>true if the object was constructed; false if the type cannot be move constructed</returns>
+    bool MoveConstructAt(void* dst, void* src) const;
+
+    /// <summary>
+    /// Runs the destructor of an object constructed in place. The memory itself is not released.
+    /// </summary>
+    void DestructAt(void* ptr) const;
+
+    /// <summary>
+    /// Default constructs count objects in place. dst must point to at least count * GetSize() bytes aligned to
+    /// GetAlignment(). Objects are laid out contiguously, as in a C array.
+    /// </summary>
+    /// <remarks>
+    /// Trivial types are zero filled with a single memset instead of being constructed one by one.
+    /// </remarks>
+    /// <returns>true if the objects were constructed; false if the type cannot be default constructed</returns>
+    bool ConstructN(void* dst, std::size_t count) const;
+
+    /// <summary>
+    /// Copy constructs count objects in place from the contiguous objects at src. See ConstructN() for the requirements
+    /// on dst.
+    /// </summary>
+    /// <remarks>
+    /// src _must_ be the same type as what is being represented by this type info and must not overlap dst. Trivially
+    /// copyable types are copied with a single memcpy.
+    /// </remarks>
+    /// <returns>true if the objects were constructed; false if the type cannot be copy constructed</returns>
+    bool CopyConstructN(void* dst, const void* src, std::size_t count) const;
+
+    /// <summary>
+    /// Move constructs count objects in place from the contiguous objects at src. See ConstructN() for the requirements
+    /// on dst.
+    /// </summary>
+    /// <remarks>
+    /// src _must_ be the same type as what is being represented by this type info and must not overlap dst. The
+    /// objects at src are left in their moved-from state and still need to be destructed. Trivially copyable types are
+    /// moved with a single memcpy.
+    /// </remarks>
+    /// <returns>true if the objects were constructed; false if the type cannot be move constructed</returns>
+    bool MoveConstructN(void* dst, void* src, std::size_t count) const;
+
+    /// <summary>
+    /// Runs the destructor of count contiguous objects constructed in place. The memory itself is not released.
+    /// </summary>
+    /// <remarks>
+    /// This is free for trivially destructible types.
+    /// </remarks>
+    void DestructN(void* ptr, std::size_t count) const;
+
     bool IsConst() const;
     bool IsPointer() const;
     bool IsArray() const;
@@ -146,6 +318,41 @@ public:
     bool IsRValueReference() const;
     bool IsReference() const;
 
+    /// <summary>
+    /// Returns true if objects of this type can be copied with memcpy (std::is_trivially_copyable).
+    /// </summary>
+    /// <remarks>
+    /// This and the other type trait queries below are false for types with no storage of their own (see GetSize()).
+    /// </remarks>
+    bool IsTriviallyCopyable() const;
+
+    /// <summary>
+    /// Returns true if destroying an object of this type does nothing, so destruction can be skipped entirely.
+    /// </summary>
+    bool IsTriviallyDestructible() const;
+
+    /// <summary>
+    /// Returns true if the type is standard layout (std::is_standard_layout).
+    /// </summary>
+    bool IsStandardLayout() const;
+
+    /// <summary>
+    /// Returns true if an object of this type can be moved to new storage with memcpy, with the old storage then
+    /// released without running the destructor. Trivially copyable types always are; classes can opt in with the
+    /// TriviallyRelocatable attribute.
+    /// </summary>
+    bool IsTriviallyRelocatable() const;
+
+    /// <summary>
+    /// Returns true if the type is a class with no non-static data members (std::is_empty).
+    /// </summary>
+    bool IsEmpty() const;
+
+    /// <summary>
+    /// Returns true if the type can be move constructed without throwing (std::is_nothrow_move_constructible).
+    /// </summary>
+    bool IsNothrowMoveConstructible() const;
+
     /// <summary>
     /// Returns true if we have any qualifiers, like const, *, &, etc...
     /// </summary>
@@ -177,57 +384,109 @@ public:
     /// This will not allow conversions of the unqualified data type to a different type. Static casts and implicit
     /// conversions that are normally allowed by C++ are not accepted because we cast a raw void*. Instead, a cast to
     /// the underlying type must be made and then let the compiler do the actual conversion to the desired type.
+    ///
+    /// The last few results are cached per type info, so repeated checks against the same type are O(1).
     /// <remarks>
     bool CanCastTo(const TypeInfo* other) const noexcept;
 
 private:
-    inline bool RequireInitialization()
+    enum class InitializationState : byte
+    {
+        Uninitialized,
+        Initializing,
+        Ready
+    };
+
+    /// <summary>
+    /// Returns true once the type info has been fully filled and published. This is the only check made on the
+    /// steady state path of ReflectTypeAndGetTypeInfo<>().
+    /// </summary>
+    inline bool IsInitialized() const
     {
-        bool required = true;
+        return _initState.load(std::memory_order_acquire) == InitializationState::Ready;
+    }
+
+    inline bool BeginInitialization()
+    {
+        InitializationState expected = InitializationState::Uninitialized;
 
-        // Returns "exchanged = true" exactly once when we flip from the value from true -> false
-        return _requireInitialization.compare_exchange_strong(required, false);
+        // Returns "exchanged = true" exactly once for the thread that gets to fill this type info
+        return _initState.compare_exchange_strong(expected, InitializationState::Initializing,
+                                                  std::memory_order_acquire, std::memory_order_relaxed);
     }
 
+    inline void FinishInitialization() { _initState.store(InitializationState::Ready, std::memory_order_release); }
+
+    /// <summary>
+    /// Blocks until another thread has finished filling this type info. Returns right away if the current thread is
+    /// the one filling it, or if waiting would close a cycle of threads waiting on each other's type infos.
+    /// </summary>
+    void WaitForInitialization() const;
+
+    /// <summary>
+    /// Returns true if the thread filling this type info is (transitively) waiting on a type info that the current
+    /// thread is filling.
+    /// </summary>
+    bool WaitWouldDeadlock() const;
+
+    /// <summary>
+    /// Records on every type info the current thread is filling that it is now waiting on typeInfo (or nothing).
+    /// </summary>
+    static void SetFillingTypesBlockedOn(const TypeInfo* typeInfo);
+
+    bool CanCastToUncached(const TypeInfo* other) const noexcept;
+
+    /// <summary>
+    /// Recursive version of CanCastToUncached() for qualifier chains that are too deep for CoreData::qualifiers.
+    /// </summary>
+    bool CanCastToByWalking(const TypeInfo* other) const noexcept;
+
+#ifndef ENTROPY_REFLECTION_IMMORTAL_TYPEINFO
     void AddRef() const;
     void Release() const;
+#endif
 
     void SetTypeName(StringOps::StringType&& name);
     void SetTypeId(TypeId typeId);
 
-    void SetConstructionHandler(ConstructionHandler&& handler);
-    void SetCopyConstructionHandler(CopyConstructionHandler&& handler);
-    void SetMoveConstructionHandler(MoveConstructionHandler&& handler);
-    void SetDestructionHandler(DestructionHandler&& handler);
+    void SetTypeOps(const TypeOps* typeOps);
 
-    void SetIsConst();
-    void SetIsPointer();
-    void SetIsLReference();
-    void SetIsRReference();
-    void SetIsArray();
+    void SetCoreData(const CoreData* coreData);
 
     void SetNextUnqualifiedType(const TypeInfo* typeInfo);
 
+    void SetFullyUnqualifiedType(const TypeInfo* typeInfo);
+
     void Destruct(void* dataPtr) const;
 
     StringOps::StringType _typeName{};
 
-    ConstructionHandler _constructionFn{};
-    CopyConstructionHandler _copyConstructionFn{};
-    MoveConstructionHandler _moveConstructionFn{};
-    DestructionHandler _destructionFn{};
+    const TypeOps* _typeOps = &cEmptyTypeOps;
 
     ModuleTypes _modules{};
 
     TypeInfoRef _nextUnqualifiedType{};
 
-    Flags _flags = Flags::None;
+    // Kept alive through _nextUnqualifiedType, so it does not need its own reference
+    const TypeInfo* _fullyUnqualifiedType = this;
+
+    const CoreData* _coreData = &cEmptyCoreData;
 
     TypeId _typeId = cInvalidTypeId;
 
+#ifndef ENTROPY_REFLECTION_IMMORTAL_TYPEINFO
     mutable std::atomic_int _refCount{0};
+#endif
+
+    std::atomic<InitializationState> _initState{InitializationState::Uninitialized};
 
-    std::atomic_bool _requireInitialization{true};
+    // While this type info is being filled: the type info the filling thread is waiting on, if any
+    mutable std::atomic<const TypeInfo*> _blockedOn{nullptr};
+
+    // Direct-mapped cache of CanCastTo() results. Each entry holds the target type info with the result in its lowest
+    // bit, so it is read and written as a single word without locking.
+    static constexpr std::size_t cCastCacheSize = 4;
+    mutable std::atomic<std::uintptr_t> _castCache[cCastCacheSize]{};
 
     //-----
 
@@ -237,6 +496,12 @@ private:
     template <typename>
     friend struct details::FillCommonTypeInfo;
 
+    template <typename>
+    friend struct details::TypeInfoCoreDataOf;
+
+    template <typename>
+    friend struct details::TypeOpsOf;
+
     template <typename, typename>
     friend struct details::HandleIsConstructible;
 
@@ -249,6 +514,9 @@ private:
     template <typename, typename>
     friend struct details::HandleIsDestructible;
 
+    template <typename, typename>
+    friend struct details::HandleCoAllocation;
+
     friend class DataObject;
     friend class TypeInfoRef;
 };
@@ -13,20 +13,51 @@ class TypeInfo;
 /// Holds a reference to a type info object. This is rarely needed, but is useful when you want to ensure a type info
 /// method is available past when the type info would have normally been destroyed on app exit.
 /// </summary>
+/// <remarks>
+/// When built with ENTROPY_REFLECTION_IMMORTAL_TYPEINFO, type infos live for the rest of the process and this is a
+/// plain pointer. Copying and destroying it then never touches the type info's shared reference count.
+/// </remarks>
 class TypeInfoRef final
 {
 public:
     constexpr TypeInfoRef() noexcept = default;
+
+#ifdef ENTROPY_REFLECTION_IMMORTAL_TYPEINFO
+    constexpr TypeInfoRef(const TypeInfo* ptr) noexcept
+        : _ptr(ptr)
+    {
+    }
+
+    TypeInfoRef(const TypeInfoRef& other) noexcept = default;
+
+    TypeInfoRef(TypeInfoRef&& other) noexcept
+        : _ptr(other._ptr)
+    {
+        other._ptr = nullptr;
+    }
+
+    ~TypeInfoRef() = default;
+
+    TypeInfoRef& operator=(const TypeInfoRef& other) noexcept = default;
+
+    TypeInfoRef& operator=(TypeInfoRef&& other) noexcept
+    {
+        _ptr       = other._ptr;
+        other._ptr = nullptr;
+        return *this;
+    }
+#else
     TypeInfoRef(const TypeInfo* ptr);
     TypeInfoRef(const TypeInfoRef& other);
     TypeInfoRef(TypeInfoRef&& other);
     ~TypeInfoRef();
 
-    inline operator const TypeInfo*() const { return _ptr; }
-    inline const TypeInfo* operator->() const { return _ptr; }
-
     TypeInfoRef& operator=(const TypeInfoRef& other);
     TypeInfoRef& operator=(TypeInfoRef&& other);
+#endif
+
+    inline operator const TypeInfo*() const { return _ptr; }
+    inline const TypeInfo* operator->() const { return _ptr; }
 
     inline operator bool() const { return _ptr != nullptr; }
     inline bool operator==(const TypeInfo* ptr) const { return _ptr == ptr; }
@@ -0,0 +1,70 @@
+// Copyright (c) Entropy Software LLC
+// This file is licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+#pragma once
+
+#include "Entropy/Core/Details/TypeId.h"
+#include <cstddef>
+
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
+
+namespace Entropy
+{
+
+class TypeInfo;
+
+/// <summary>
+/// Looks up the type info that was created for the specified type id. Only types that have been reflected (e.g. through
+/// ReflectTypeAndGetTypeInfo<>()) can be found, and only once their type info is fully filled.
+/// </summary>
+/// <remarks>
+/// This method is wait-free and can be called from any number of threads without taking a lock.
+/// </remarks>
+/// <returns>The type info for the type id, or nullptr if the type has not been reflected</returns>
+const TypeInfo* FindTypeById(TypeId typeId) noexcept;
+
+/// <summary>
+/// Looks up the type info whose name (see TypeInfo::GetTypeName()) exactly matches the specified name. Only types that
+/// have been reflected can be found.
+/// </summary>
+/// <remarks>
+/// This method does not take a lock. Once FreezeRegistry() has been called, names registered before the freeze are
+/// resolved with one hash and one string compare.
+/// </remarks>
+/// <returns>The type info for the name, or nullptr if no reflected type has that name</returns>
+const TypeInfo* FindTypeByName(const char* typeName, std::size_t length) noexcept;
+
+/// <summary>
+/// Looks up the type info for a null terminated type name. See FindTypeByName(const char*, std::size_t).
+/// </summary>
+const TypeInfo* FindTypeByName(const char* typeName) noexcept;
+
+#if __cplusplus >= 201703L
+inline const TypeInfo* FindTypeByName(std::string_view typeName) noexcept
+{
+    return FindTypeByName(typeName.data(), typeName.size());
+}
+#endif
+
+/// <summary>
+/// Builds a minimal perfect hash over the names of every type reflected so far. Call this once startup has reflected
+/// the types that will be looked up by name.
+/// </summary>
+/// <remarks>
+/// Types can still be reflected after freezing; they are found through the slower, growable name table until the next
+/// call to FreezeRegistry().
+/// </remarks>
+void FreezeRegistry() noexcept;
+
+namespace details
+{
+
+void RegisterTypeInfo(const TypeInfo* typeInfo) noexcept;
+void UnregisterTypeInfo(const TypeInfo* typeInfo) noexcept;
+
+} // namespace details
+
+} // namespace Entropy
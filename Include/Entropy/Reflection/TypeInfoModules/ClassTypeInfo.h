@@ -4,33 +4,49 @@
 
 #pragma once
 
-#include "Entropy/Core/Details/MapOps.h"
 #include "Entropy/Core/Details/TypeId.h"
 #include "Entropy/Core/Details/VectorOps.h"
 #include "Entropy/Reflection/DataObject/DataObject.h"
 #include "Entropy/Reflection/Details/AttributeCollection.h"
 #include "Entropy/Reflection/Details/TypeTraits.h"
+#include "Entropy/Reflection/TypeInfo/TypeInfoRef.h"
 #include "TypeInfoModule.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
 
 namespace Entropy
 {
 namespace Reflection
 {
 
+/// <summary>
+/// One attribute value of a class or member. The value itself lives in the AttributeStorage of the class.
+/// </summary>
 struct AttributeData
 {
     AttributeData() {}
-    AttributeData(DataObject&& dataObj);
+    AttributeData(TypeId typeId, const TypeInfo* typeInfo, const void* data)
+        : _typeId(typeId)
+        , _typeInfo(typeInfo)
+        , _data(data)
+    {
+    }
 
     AttributeData(const AttributeData&) = default;
     AttributeData(AttributeData&&)      = default;
 
-    inline const TypeInfo* GetTypeInfo() const { return _dataObj.GetTypeInfo(); }
+    inline TypeId GetTypeId() const { return _typeId; }
+    inline const TypeInfo* GetTypeInfo() const { return _typeInfo; }
 
     template <typename T>
     inline bool IsType() const
     {
-        return _dataObj.IsExactType<T>();
+        return _typeId == Traits::TypeIdOf<T>{}();
     }
 
     template <typename T>
@@ -38,7 +54,7 @@ struct AttributeData
     {
         if (IsType<T>())
         {
-            return &_dataObj.GetData<T>();
+            return GetData<T>();
         }
 
         return nullptr;
@@ -47,38 +63,114 @@ struct AttributeData
     template <typename T>
     inline const T* GetData() const
     {
-        return &_dataObj.GetData<T>();
+        return static_cast<const T*>(_data);
     }
 
     AttributeData& operator=(const AttributeData& other) = default;
     AttributeData& operator=(AttributeData&& other)      = default;
 
-    inline bool operator==(const AttributeData& other) const
+    inline bool operator==(const AttributeData& other) const { return GetTypeInfo() == other.GetTypeInfo(); }
+
+private:
+    TypeId _typeId = cInvalidTypeId;
+    TypeInfoRef _typeInfo{};
+    const void* _data{};
+};
+
+/// <summary>
+/// Contiguous view over the attributes of one class or member, sorted by type id.
+/// </summary>
+class AttributeRange final
+{
+public:
+    AttributeRange() = default;
+    AttributeRange(const AttributeData* first, std::size_t count)
+        : _first(first)
+        , _count(count)
     {
-        return _dataObj.GetTypeInfo() == other._dataObj.GetTypeInfo();
     }
 
+    inline const AttributeData* begin() const { return _first; }
+    inline const AttributeData* end() const { return _first + _count; }
+    inline std::size_t size() const { return _count; }
+    inline bool empty() const { return _count == 0; }
+    inline const AttributeData& operator[](std::size_t index) const { return _first[index]; }
+
 private:
-    DataObject _dataObj{};
+    const AttributeData* _first = nullptr;
+    std::size_t _count          = 0;
+};
+
+/// <summary>
+/// Holds the attributes of a class and of all of its members. Every owner's attributes are one sorted run of a single
+/// class-wide list, and the values are packed next to each other in a few blocks instead of one allocation each.
+/// </summary>
+/// <remarks>
+/// Values are never moved once placed, and are destructed in reverse order when the storage is destroyed. Attribute
+/// types larger than cBlockSize or aligned beyond alignof(std::max_align_t) are not supported.
+/// </remarks>
+class AttributeStorage final
+{
+public:
+    static constexpr std::size_t cBlockSize = 1024;
+
+    AttributeStorage() = default;
+    ~AttributeStorage();
+
+    AttributeStorage(const AttributeStorage&)            = delete;
+    AttributeStorage& operator=(const AttributeStorage&) = delete;
+
+    /// <summary>
+    /// Returns uninitialized room for a value, or null if the size or alignment is not supported.
+    /// </summary>
+    void* Allocate(std::size_t size, std::size_t alignment);
+
+private:
+    struct Block
+    {
+        // Intentionally leaves the storage uninitialized
+        Block() {}
+
+        typename std::aligned_storage<cBlockSize, alignof(std::max_align_t)>::type storage;
+        Block* next = nullptr;
+    };
+
+    VectorOps::VectorType<AttributeData> _attributes{};
+    Block* _blocks           = nullptr;
+    std::size_t _blockOffset = 0;
+
+    friend class AttributeContainer;
 };
 
 class AttributeContainer
 {
 public:
+    // Attribute sets up to this size are searched linearly. Anything larger is binary searched.
+    static constexpr std::size_t cLinearSearchAttributeCount = 8;
+
     AttributeContainer()                          = default;
     AttributeContainer(const AttributeContainer&) = delete;
     AttributeContainer(AttributeContainer&&)      = default;
     virtual ~AttributeContainer();
 
-    inline const MapOps::MapType<TypeId, AttributeData>& GetAllAttributes() const { return _attributes; }
+    /// <summary>
+    /// Returns the attributes sorted by type id.
+    /// </summary>
+    inline AttributeRange GetAllAttributes() const
+    {
+        if (_attributeCount == 0)
+        {
+            return AttributeRange();
+        }
+
+        return AttributeRange(&VectorOps::At(_attributeStorage->_attributes, _attributeOffset), _attributeCount);
+    }
 
     template <typename T>
     inline const T* TryGetAttribute() const
     {
-        TypeId typeId = Traits::TypeIdOf<T>{}();
-
-        const AttributeData* data = nullptr;
-        if (MapOps::TryGetValue(_attributes, typeId, &data))
+        const AttributeData* data = FindAttribute(Traits::TypeIdOf<T>{}());
+        if (data != nullptr)
         {
             return data->GetData<T>();
         }
@@ -86,21 +178,54 @@ public:
         return nullptr;
     }
 
+    inline const AttributeData* FindAttribute(TypeId typeId) const
+    {
+        const AttributeRange attributes = GetAllAttributes();
+        if (ENTROPY_LIKELY(attributes.size() <= cLinearSearchAttributeCount))
+        {
+            for (const AttributeData& data : attributes)
+            {
+                if (data.GetTypeId() == typeId)
+                {
+                    return &data;
+                }
+            }
+            return nullptr;
+        }
+
+        return FindAttributeSorted(attributes, typeId);
+    }
+
 private:
     template <std::size_t Idx = 0, typename... TAttrTypes>
     inline typename std::enable_if<Idx == sizeof...(TAttrTypes), void>::type AddAttribute(
-        AttributeCollection<TAttrTypes...>&)
+        AttributeStorage&, AttributeCollection<TAttrTypes...>&)
     {
     }
 
     template <std::size_t Idx = 0, typename... TAttrTypes>
     inline typename std::enable_if<Idx != sizeof...(TAttrTypes), void>::type AddAttribute(
-        AttributeCollection<TAttrTypes...>&);
+        AttributeStorage& storage, AttributeCollection<TAttrTypes...>&);
 
     template <typename... TAttrTypes>
-    inline void AddAttributes(AttributeCollection<TAttrTypes...>&& attr);
+    inline void AddAttributes(AttributeStorage& storage, AttributeCollection<TAttrTypes...>&& attr);
+
+    /// <summary>
+    /// Appends data to this container's run at the end of the storage's list. An attribute of the same type is
+    /// destructed and replaced.
+    /// </summary>
+    void AppendAttribute(AttributeStorage& storage, const AttributeData& data);
+
+    /// <summary>
+    /// Sorts this container's run once all of its attributes have been appended.
+    /// </summary>
+    void SortAttributes(AttributeStorage& storage);
 
-    MapOps::MapType<TypeId, AttributeData> _attributes{};
+    static const AttributeData* FindAttributeSorted(const AttributeRange& attributes, TypeId typeId);
+
+    const AttributeStorage* _attributeStorage = nullptr;
+    std::uint32_t _attributeOffset            = 0;
+    std::uint32_t _attributeCount             = 0;
 
     template <typename, typename, typename>
     friend struct FillModuleTypeInfo;
@@ -114,18 +239,181 @@ class MemberDescription : public AttributeContainer
 public:
     MemberDescription(const char* memberName, const TypeInfo* memberType)
         : _memberName(memberName)
+        , _memberNameLength(std::strlen(memberName))
         , _memberType(memberType)
     {
     }
 
     inline const char* GetMemberName() const { return _memberName; }
+    inline std::size_t GetMemberNameLength() const { return _memberNameLength; }
     inline const TypeInfo* GetMemberType() const { return _memberType; }
 
+    /// <summary>
+    /// Returns true if GetOffset() is known. Only members of standard layout classes have an offset.
+    /// </summary>
+    inline bool HasOffset() const { return _layout.offset >= 0; }
+
+    /// <summary>
+    /// Returns the byte offset of the member from the start of its class, or -1 if the class is not standard layout.
+    /// </summary>
+    inline int GetOffset() const { return _layout.offset; }
+
+    inline std::size_t GetSize() const { return _layout.size; }
+    inline std::size_t GetAlignment() const { return _layout.alignment; }
+
+    /// <summary>
+    /// Returns the address of this member inside object, which must point to an instance of the class that declared
+    /// the member. This is pointer arithmetic when the offset is known and one indirect call otherwise.
+    /// </summary>
+    inline void* GetMemberPtr(void* object) const
+    {
+        if (ENTROPY_LIKELY(_layout.offset >= 0))
+        {
+            return static_cast<byte*>(object) + _layout.offset;
+        }
+        return _layout.accessor(object);
+    }
+
+    inline const void* GetMemberPtr(const void* object) const { return GetMemberPtr(const_cast<void*>(object)); }
+
+    /// <summary>
+    /// Returns this member of object as a T, or nullptr if the member cannot be cast to T (see TypeInfo::CanCastTo()).
+    /// No DataObject is created.
+    /// </summary>
+    template <typename T>
+    inline T* Get(void* object) const;
+
+    template <typename T>
+    inline const T* Get(const void* object) const;
+
+    /// <summary>
+    /// Copies or moves value into this member of object.
+    /// </summary>
+    /// <returns>true if the member was assigned; false if the member is const or not of type T</returns>
+    template <typename T>
+    inline bool Set(void* object, T&& value) const;
+
 private:
+    inline void SetLayout(const MemberLayout& layout) { _layout = layout; }
+
     const char* _memberName{};
+    std::size_t _memberNameLength = 0;
     const TypeInfo* _memberType{};
+    MemberLayout _layout{};
+
+    friend class ClassDescription;
 };
 
+class ClassDescription;
+
+/// <summary>
+/// A reflected member as seen from a class that declares or inherits it. Listed by ClassDescription::GetAllMembers().
+/// </summary>
+/// <remarks>
+/// Unlike MemberDescription, GetMemberPtr() takes the address of the class the list belongs to, even when the member
+/// was declared by a base class. Attributes are kept once on the declaring class's MemberDescription.
+/// </remarks>
+class FlattenedMember
+{
+public:
+    FlattenedMember(const char* memberName, const TypeInfo* memberType, const TypeInfo* declaringClass,
+                    const ClassDescription* declaringClassDesc, std::uint32_t memberIndex, const MemberLayout& layout,
+                    MemberAccessor upcast)
+        : _memberName(memberName)
+        , _memberType(memberType)
+        , _declaringClass(declaringClass)
+        , _declaringClassDesc(declaringClassDesc)
+        , _memberIndex(memberIndex)
+        , _layout(layout)
+        , _upcast(upcast)
+    {
+    }
+
+    inline const char* GetMemberName() const { return _memberName; }
+    inline const TypeInfo* GetMemberType() const { return _memberType; }
+
+    /// <summary>
+    /// Returns the type info of the class that declared this member
+    /// </summary>
+    inline const TypeInfo* GetDeclaringClass() const { return _declaringClass; }
+
+    /// <summary>
+    /// Returns true if GetOffset() is known. Inherited members only have an offset in standard layout classes.
+    /// </summary>
+    inline bool HasOffset() const { return _layout.offset >= 0; }
+
+    /// <summary>
+    /// Returns the byte offset of the member from the start of the class the list belongs to, or -1 if unknown.
+    /// </summary>
+    inline int GetOffset() const { return _layout.offset; }
+
+    inline std::size_t GetSize() const { return _layout.size; }
+    inline std::size_t GetAlignment() const { return _layout.alignment; }
+
+    /// <summary>
+    /// Returns the description of this member on its declaring class, which holds the member attributes. Null if the
+    /// declaring class was still being filled when this list was built, which only happens with re-entrant reflection.
+    /// </summary>
+    const MemberDescription* GetMemberDescription() const;
+
+    /// <summary>
+    /// Returns the address of this member inside object, which must point to an instance of the class the list
+    /// belongs to. Inherited members without an offset first adjust object to the declaring class.
+    /// </summary>
+    inline void* GetMemberPtr(void* object) const
+    {
+        if (ENTROPY_LIKELY(_layout.offset >= 0))
+        {
+            return static_cast<byte*>(object) + _layout.offset;
+        }
+        return _layout.accessor(_upcast ? _upcast(object) : object);
+    }
+
+    inline const void* GetMemberPtr(const void* object) const { return GetMemberPtr(const_cast<void*>(object)); }
+
+    /// <summary>
+    /// See MemberDescription::Get()
+    /// </summary>
+    template <typename T>
+    inline T* Get(void* object) const;
+
+    template <typename T>
+    inline const T* Get(const void* object) const;
+
+    /// <summary>
+    /// See MemberDescription::Set()
+    /// </summary>
+    template <typename T>
+    inline bool Set(void* object, T&& value) const;
+
+private:
+    const char* _memberName{};
+    const TypeInfo* _memberType{};
+    const TypeInfo* _declaringClass{};
+
+    // Resolved once when the list is built. Members are kept by index because the declaring class's member list may
+    // still grow while this class is filled.
+    const ClassDescription* _declaringClassDesc{};
+    std::uint32_t _memberIndex = 0;
+
+    MemberLayout _layout{};
+
+    // Converts the address of the class the list belongs to into the address of the declaring class, or null for the
+    // class's own members
+    MemberAccessor _upcast = nullptr;
+};
+
+namespace details
+{
+
+template <typename TClass, typename TBaseClass, typename = void>
+struct AddInheritedMembers;
+
+template <typename TClass, typename TBaseClass>
+struct HandleInheritedMember;
+
+} // namespace details
+
 /// <summary>
 /// Contains class hierarchy and member information
 /// </summary>
@@ -134,19 +422,82 @@ class ClassDescription : public AttributeContainer
 public:
     inline const VectorOps::VectorType<const TypeInfo*>& GetTemplateParameters() const { return _templateParameters; }
     inline const TypeInfo* GetBaseClassTypeInfo() const { return _baseClassTypeInfo; }
-    inline const MapOps::MapType<const char*, MemberDescription>& GetMembers() const { return _members; }
+
+    /// <summary>
+    /// Returns this class's own members in declaration order.
+    /// </summary>
+    inline const VectorOps::VectorType<MemberDescription>& GetMembers() const { return _members; }
+
+    /// <summary>
+    /// Looks up one of this class's own members by name. Base class members are not searched.
+    /// </summary>
+    /// <remarks>
+    /// Names are hashed once when the class is reflected, so a lookup is one hash of the requested name and usually a
+    /// single string compare.
+    /// </remarks>
+    /// <returns>The member, or nullptr if this class does not reflect a member with that name</returns>
+    const MemberDescription* FindMember(const char* name, std::size_t length) const;
+
+    /// <summary>
+    /// Looks up a member by a null terminated name. See FindMember(const char*, std::size_t).
+    /// </summary>
+    inline const MemberDescription* FindMember(const char* name) const { return FindMember(name, std::strlen(name)); }
+
+#if __cplusplus >= 201703L
+    inline const MemberDescription* FindMember(std::string_view name) const
+    {
+        return FindMember(name.data(), name.size());
+    }
+#endif
+
+    /// <summary>
+    /// Returns every reflected member of this class, including the ones inherited from reflected base classes. Base
+    /// class members come first, each class's members in declaration order.
+    /// </summary>
+    /// <remarks>
+    /// The list is built once when the class is reflected, so walking all members of an object is a single linear
+    /// scan without following GetBaseClassTypeInfo(). A member that hides a base class member of the same name is
+    /// listed after it.
+    /// </remarks>
+    inline const VectorOps::VectorType<FlattenedMember>& GetAllMembers() const { return _allMembers; }
 
 private:
+    // Open addressing slot of the member name index. index is one past the member's position so zero marks an empty
+    // slot.
+    struct MemberNameSlot
+    {
+        std::uint32_t hash  = 0;
+        std::uint32_t index = 0;
+    };
+
     void AddTemplateParameter(const TypeInfo* templateParameter);
     void SetBaseClass(const TypeInfo* baseClass);
-    void AddMember(const char* name, MemberDescription&& memberInfo);
+    void AddMember(MemberDescription&& memberInfo);
+    void SetMemberLayout(const char* name, const MemberLayout& layout);
+    void AddFlattenedMember(FlattenedMember&& member);
+
+    // Position of member, which must be one of ours, in GetMembers()
+    inline std::uint32_t GetMemberIndex(const MemberDescription* member) const
+    {
+        return static_cast<std::uint32_t>(member - &VectorOps::At(_members, 0));
+    }
+
+    void InsertMemberName(const MemberNameSlot& slot);
 
     const TypeInfo* _baseClassTypeInfo = nullptr;
-    MapOps::MapType<const char*, MemberDescription> _members{};
+    VectorOps::VectorType<MemberDescription> _members{};
+    VectorOps::VectorType<MemberNameSlot> _memberNameIndex{};
     VectorOps::VectorType<const TypeInfo*> _templateParameters{};
+    VectorOps::VectorType<FlattenedMember> _allMembers{};
+
+    // Attribute values of the class and all of its members
+    AttributeStorage _attributeStorage{};
 
     template <typename, typename, typename>
     friend struct FillModuleTypeInfo;
+
+    template <typename, typename>
+    friend struct details::HandleInheritedMember;
 };
 
 /// <summary>
@@ -181,23 +532,49 @@ struct FillModuleTypeInfo<ClassTypeInfo, T> : public DefaultFillModuleTypeInfo<C
     void HandleClass(ClassTypeInfo& module, const TypeInfo* thisTypeInfo,
                      AttributeCollection<TAttrTypes...>&& classAttr)
     {
-        module.GetOrAddClassDescription()->AddAttributes(std::move(classAttr));
+        _thisTypeInfo = thisTypeInfo;
+
+        ClassDescription* classDesc = module.GetOrAddClassDescription();
+        classDesc->AddAttributes(classDesc->_attributeStorage, std::move(classAttr));
     }
 
     template <typename TMember, typename... TAttrTypes>
     void HandleClassMember(ClassTypeInfo& module, const char* memberName, const TypeInfo* memberTypeInfo,
                            AttributeCollection<TAttrTypes...>&& memberAttr)
     {
+        ClassDescription* classDesc = module.GetOrAddClassDescription();
+
         MemberDescription memberInfo(memberName, memberTypeInfo);
-        memberInfo.AddAttributes(std::move(memberAttr));
+        memberInfo.AddAttributes(classDesc->_attributeStorage, std::move(memberAttr));
 
-        module.GetOrAddClassDescription()->AddMember(memberName, std::move(memberInfo));
+        classDesc->AddMember(std::move(memberInfo));
+    }
+
+    template <typename TMember>
+    void HandleClassMemberLayout(ClassTypeInfo& module, const char* memberName, const MemberLayout& memberLayout)
+    {
+        ClassDescription* classDesc = module.GetOrAddClassDescription();
+        classDesc->SetMemberLayout(memberName, memberLayout);
+
+        const MemberDescription* member = classDesc->FindMember(memberName);
+        if (ENTROPY_LIKELY(member != nullptr))
+        {
+            classDesc->AddFlattenedMember(FlattenedMember(member->GetMemberName(), member->GetMemberType(),
+                                                          _thisTypeInfo, classDesc, classDesc->GetMemberIndex(member),
+                                                          memberLayout, nullptr));
+        }
     }
 
     template <typename TBaseClass>
     void HandleBaseClass(ClassTypeInfo& module, const TypeInfo* baseClassTypeInfo)
     {
-        module.GetOrAddClassDescription()->SetBaseClass(baseClassTypeInfo);
+        ClassDescription* classDesc = module.GetOrAddClassDescription();
+        classDesc->SetBaseClass(baseClassTypeInfo);
+
+        // Base classes are handled before members, so inherited members end up in front of this class's own. They are
+        // enumerated at compile time instead of copied from the base class type info, which another thread may still
+        // be filling.
+        details::AddInheritedMembers<T, TBaseClass>{}(*classDesc);
     }
 
     template <typename TTemplateClass>
@@ -210,6 +587,9 @@ struct FillModuleTypeInfo<ClassTypeInfo, T> : public DefaultFillModuleTypeInfo<C
             module.GetOrAddClassDescription()->AddTemplateParameter(templateParamTypeInfo);
         }
     }
+
+private:
+    const TypeInfo* _thisTypeInfo = nullptr;
 };
 
 } // namespace Reflection
@@ -3,6 +3,8 @@
 // See the LICENSE file in the project root for more information.
 
 #include "Entropy/Reflection/DataObject/DataObjectFactory.h"
+#include "Entropy/Reflection/Details/MemberEnumeration.h"
+#include <new>
 
 namespace Entropy
 {
@@ -13,51 +15,222 @@ namespace details
 {
 
 template <typename TAttr, typename = void>
-struct AllocateAttribute
+struct ConstructAttribute
 {
-    inline DataObject operator()(TAttr&& attrData) const { return Entropy::DataObjectFactory::Create<TAttr>(attrData); }
+    inline TAttr* operator()(void* dst, TAttr&& attrData) const { return new (dst) TAttr(attrData); }
 };
 
 template <typename TAttr>
-struct AllocateAttribute<TAttr, typename std::enable_if<Traits::IsAllocatorMoveConstructible<TAttr>::value>::type>
+struct ConstructAttribute<TAttr, typename std::enable_if<Traits::IsAllocatorMoveConstructible<TAttr>::value>::type>
 {
-    inline DataObject operator()(TAttr&& attrData) const
-    {
-        return Entropy::DataObjectFactory::Create<TAttr>(std::move(attrData));
-    }
+    inline TAttr* operator()(void* dst, TAttr&& attrData) const { return new (dst) TAttr(std::move(attrData)); }
 };
 
 } // namespace details
 
 template <std::size_t Idx, typename... TAttrTypes>
 inline typename std::enable_if<Idx != sizeof...(TAttrTypes), void>::type AttributeContainer::AddAttribute(
-    AttributeCollection<TAttrTypes...>& attr)
+    AttributeStorage& storage, AttributeCollection<TAttrTypes...>& attr)
 {
     using TAttr = Entropy::Traits::UnqualifiedType_t<decltype(attr.template GetAt<Idx>())>;
 
     const TypeInfo* typeInfo = ReflectTypeAndGetTypeInfo<TAttr>();
     if (ENTROPY_LIKELY(typeInfo))
     {
-        DataObject obj = details::AllocateAttribute<TAttr>{}(std::move(attr.template GetAt<Idx>()));
-        if (ENTROPY_LIKELY(obj))
+        void* dst = storage.Allocate(sizeof(TAttr), alignof(TAttr));
+        if (ENTROPY_LIKELY(dst))
         {
-            MapOps::AddOrUpdate(_attributes, Entropy::Traits::TypeIdOf<TAttr>{}(), AttributeData(std::move(obj)));
+            TAttr* value = details::ConstructAttribute<TAttr>{}(dst, std::move(attr.template GetAt<Idx>()));
+            AppendAttribute(storage, AttributeData(Entropy::Traits::TypeIdOf<TAttr>{}(), typeInfo, value));
         }
         else
         {
-            ENTROPY_LOG_ERROR("Failed to create DataObject for attribute [Attr Name: " << Traits::TypeNameOf<TAttr>{}()
-                                                                                       << "]");
+            ENTROPY_LOG_ERROR("Failed to allocate storage for attribute [Attr Name: " << Traits::TypeNameOf<TAttr>{}()
+                                                                                      << "]");
         }
     }
 
-    AddAttribute<Idx + 1>(attr);
+    AddAttribute<Idx + 1>(storage, attr);
 }
 
 template <typename... TAttrTypes>
-inline void AttributeContainer::AddAttributes(AttributeCollection<TAttrTypes...>&& attr)
+inline void AttributeContainer::AddAttributes(AttributeStorage& storage, AttributeCollection<TAttrTypes...>&& attr)
+{
+    AddAttribute<0>(storage, attr);
+    SortAttributes(storage);
+}
+
+//=======================
+
+namespace details
+{
+
+template <typename T, typename TMember>
+inline T* GetMemberAs(const TMember& member, void* object)
+{
+    if (ENTROPY_LIKELY(member.GetMemberType()->CanCastTo(ReflectTypeAndGetTypeInfo<T>())))
+    {
+        return static_cast<T*>(member.GetMemberPtr(object));
+    }
+    return nullptr;
+}
+
+template <typename T, typename TMember>
+inline const T* GetMemberAs(const TMember& member, const void* object)
+{
+    if (ENTROPY_LIKELY(member.GetMemberType()->CanCastTo(ReflectTypeAndGetTypeInfo<const T>())))
+    {
+        return static_cast<const T*>(member.GetMemberPtr(object));
+    }
+    return nullptr;
+}
+
+template <typename T, typename TMember>
+inline bool SetMember(const TMember& member, void* object, T&& value)
+{
+    using ValueType = typename std::remove_cv<typename std::remove_reference<T>::type>::type;
+
+    ValueType* memberPtr = GetMemberAs<ValueType>(member, object);
+    if (ENTROPY_UNLIKELY(memberPtr == nullptr))
+    {
+        return false;
+    }
+
+    *memberPtr = std::forward<T>(value);
+    return true;
+}
+
+} // namespace details
+
+template <typename T>
+inline T* MemberDescription::Get(void* object) const
+{
+    return details::GetMemberAs<T>(*this, object);
+}
+
+template <typename T>
+inline const T* MemberDescription::Get(const void* object) const
+{
+    return details::GetMemberAs<T>(*this, object);
+}
+
+template <typename T>
+inline bool MemberDescription::Set(void* object, T&& value) const
+{
+    return details::SetMember(*this, object, std::forward<T>(value));
+}
+
+template <typename T>
+inline T* FlattenedMember::Get(void* object) const
+{
+    return details::GetMemberAs<T>(*this, object);
+}
+
+template <typename T>
+inline const T* FlattenedMember::Get(const void* object) const
 {
-    AddAttribute<0>(attr);
+    return details::GetMemberAs<T>(*this, object);
 }
 
+template <typename T>
+inline bool FlattenedMember::Set(void* object, T&& value) const
+{
+    return details::SetMember(*this, object, std::forward<T>(value));
+}
+
+//=======================
+
+namespace details
+{
+
+template <typename TClass, typename TBaseClass>
+void* UpcastToBaseClass(void* object)
+{
+    return static_cast<TBaseClass*>(static_cast<TClass*>(object));
+}
+
+// Called for each member declared by TBaseClass while TClass is being reflected
+template <typename TClass, typename TBaseClass>
+struct HandleInheritedMember
+{
+    explicit HandleInheritedMember(ClassDescription* classDesc)
+        : _classDesc(classDesc)
+    {
+    }
+
+    template <typename TMember, typename... TAttrTypes>
+    void operator()(const char* memberName, int memberOffset, void* (*memberAccessor)(void*),
+                    AttributeCollection<TAttrTypes...>&& memberAttr)
+    {
+        using TMemberNoRef = typename std::remove_reference<TMember>::type;
+
+        // A standard layout class shares its address with its base classes, so the base class offset still applies.
+        // Anything else has to go through the declaring class.
+        MemberLayout memberLayout;
+        memberLayout.offset    = std::is_standard_layout<TClass>::value ? memberOffset : -1;
+        memberLayout.size      = sizeof(TMemberNoRef);
+        memberLayout.alignment = alignof(TMemberNoRef);
+        memberLayout.accessor  = memberAccessor;
+
+        // The base class's member list can only be read once it is fully filled. It is still being filled when it is
+        // reflected re-entrantly, and then the member description is left unresolved.
+        const TypeInfo* baseClassTypeInfo     = ReflectTypeAndGetTypeInfo<TBaseClass>();
+        const ClassDescription* baseClassDesc = nullptr;
+        std::uint32_t memberIndex             = 0;
+        if (ENTROPY_LIKELY(baseClassTypeInfo->IsInitialized()))
+        {
+            const ClassDescription* classDesc = baseClassTypeInfo->Get<ClassTypeInfo>().GetClassDescription();
+            const MemberDescription* member   = (classDesc != nullptr) ? classDesc->FindMember(memberName) : nullptr;
+            if (ENTROPY_LIKELY(member != nullptr))
+            {
+                baseClassDesc = classDesc;
+                memberIndex   = classDesc->GetMemberIndex(member);
+            }
+        }
+
+        _classDesc->AddFlattenedMember(FlattenedMember(memberName, ReflectTypeAndGetTypeInfo<TMemberNoRef>(),
+                                                       baseClassTypeInfo, baseClassDesc, memberIndex, memberLayout,
+                                                       &UpcastToBaseClass<TClass, TBaseClass>));
+    }
+
+private:
+    ClassDescription* _classDesc = nullptr;
+};
+
+// The base class is not reflected, so it has no members to add
+template <typename TClass, typename TBaseClass, typename>
+struct AddInheritedMembers
+{
+    inline void operator()(ClassDescription& classDesc) const {}
+};
+
+template <typename TClass, typename TBaseClass>
+struct AddInheritedMembers<TClass, TBaseClass,
+                           typename std::enable_if<Traits::IsReflectedType<TBaseClass>::value &&
+                                                   !Traits::HasBaseClass<TBaseClass>::value>::type>
+{
+    inline void operator()(ClassDescription& classDesc) const
+    {
+        ForEachReflectedMemberType<false /* IncludeSubclasses */, TBaseClass>(
+            HandleInheritedMember<TClass, TBaseClass>(&classDesc));
+    }
+};
+
+// Members of the base class's own bases come first
+template <typename TClass, typename TBaseClass>
+struct AddInheritedMembers<TClass, TBaseClass,
+                           typename std::enable_if<Traits::IsReflectedType<TBaseClass>::value &&
+                                                   Traits::HasBaseClass<TBaseClass>::value>::type>
+{
+    inline void operator()(ClassDescription& classDesc) const
+    {
+        AddInheritedMembers<TClass, Traits::BaseClassOf_t<TBaseClass>>{}(classDesc);
+        ForEachReflectedMemberType<false /* IncludeSubclasses */, TBaseClass>(
+            HandleInheritedMember<TClass, TBaseClass>(&classDesc));
+    }
+};
+
+} // namespace details
+
 } // namespace Reflection
 } // namespace Entropy
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "Entropy/Reflection/Details/AttributeCollection.h"
+#include <cstddef>
 
 namespace Entropy
 {
@@ -14,6 +15,23 @@ class TypeInfo;
 namespace Reflection
 {
 
+/// <summary>
+/// Returns the address of a reflected member given the address of the object that holds it
+/// </summary>
+using MemberAccessor = void* (*)(void* object);
+
+/// <summary>
+/// Where a reflected member is stored inside its class
+/// </summary>
+struct MemberLayout
+{
+    // Byte offset from the start of the class, or -1 if the class is not standard layout
+    int offset              = -1;
+    std::size_t size        = 0;
+    std::size_t alignment   = 0;
+    MemberAccessor accessor = nullptr;
+};
+
 template <typename TModule>
 struct DefaultFillModuleTypeInfo
 {
@@ -37,6 +55,15 @@ struct DefaultFillModuleTypeInfo
     {
     }
 
+    /// <summary>
+    /// Called for each member on a reflected class right after HandleClassMember(). If the type is not reflected, this
+    /// is never called.
+    /// </summary>
+    template <typename TMember>
+    void HandleClassMemberLayout(TModule& module, const char* memberName, const MemberLayout& memberLayout)
+    {
+    }
+
     /// <summary>
     /// Called for the reflected class's declared base class. If the type is not reflected or has no declared base
     /// class, this is never called.
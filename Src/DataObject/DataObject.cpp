@@ -3,19 +3,44 @@
 // See the LICENSE file in the project root for more information.
 
 #include "Entropy/Reflection/DataObject/DataObject.h"
-#include "Entropy/Core/Details/AllocatorTraits.h"
 #include "Entropy/Core/Log.h"
+#include "Entropy/Reflection/DataObject/DataObjectArena.h"
+#include "Entropy/Reflection/DataObject/DataObjectContainerPool.h"
 #include "Entropy/Reflection/TypeInfo/RuntimeReflectionMethods.h"
 #include "Entropy/Reflection/TypeInfo/TypeInfo.h"
+#include <new>
 
 namespace Entropy
 {
 
+namespace
+{
+
+template <typename TContainer>
+TContainer* CreatePooledContainer()
+{
+    static_assert(sizeof(TContainer) <= details::DataObjectContainerPool::cBlockSize &&
+                      alignof(TContainer) <= details::DataObjectContainerPool::cBlockAlignment,
+                  "Container does not fit in a pooled block");
+
+    void* block = details::DataObjectContainerPool::Allocate();
+    return block != nullptr ? new (block) TContainer() : nullptr;
+}
+
+template <typename TContainer>
+void DestroyPooledContainer(TContainer* container)
+{
+    container->~TContainer();
+    details::DataObjectContainerPool::Free(container);
+}
+
+} // namespace
+
 DataObject::DataObject(std::nullptr_t) {}
 
 DataObject::DataObject(const TypeInfo* typeInfo, void* data, bool wrapped, DataPointerType pointerType)
 {
-    _container = AllocatorOps::CreateInstance<DataObjectContainer>();
+    _container = CreatePooledContainer<DataObjectContainer>();
     ENTROPY_ASSERT(_container);
 
     if (ENTROPY_LIKELY(_container != nullptr))
@@ -27,12 +52,114 @@ DataObject::DataObject(const TypeInfo* typeInfo, void* data, bool wrapped, DataP
     }
 }
 
+DataObject DataObject::AllocateWithPayload(const TypeInfo* typeInfo, void*& payload)
+{
+    DataObject ret;
+
+    // Objects created while a type info is being filled belong to the type info and live as long as it does, so they
+    // never come from an arena, even if the type happens to be reflected for the first time inside an arena scope
+    DataObjectArena* arena = DataObjectArena::GetCurrent();
+    if (arena != nullptr && (typeInfo->GetSize() > 0) &&
+        (details::TypeInfoInitializationScope::GetInnermost() == nullptr))
+    {
+        // Payloads the arena cannot hold fall through to the regular allocations below
+        ret._container = arena->AllocateContainer(typeInfo->GetSize(), typeInfo->GetAlignment(), &payload);
+        if (ret._container != nullptr)
+        {
+            ret._container->_typeInfo = typeInfo;
+            return ret;
+        }
+    }
+
+    if ((typeInfo->GetSize() > 0) && (typeInfo->GetSize() <= cInlineStorageSize) &&
+        (typeInfo->GetAlignment() <= cInlineStorageAlignment) &&
+        (typeInfo->IsTriviallyRelocatable() || typeInfo->IsNothrowMoveConstructible()))
+    {
+        InlineDataObjectContainer* container = CreatePooledContainer<InlineDataObjectContainer>();
+        if (ENTROPY_LIKELY(container != nullptr))
+        {
+            container->_payloadStorage = PayloadStorage::Inline;
+            payload                    = &container->_inlineStorage;
+        }
+        ret._container = container;
+    }
+    else if (typeInfo->_typeOps->allocateContainer != nullptr)
+    {
+        ret._container = typeInfo->_typeOps->allocateContainer(&payload);
+        if (ENTROPY_LIKELY(ret._container != nullptr))
+        {
+            ret._container->_payloadStorage = PayloadStorage::CoAllocated;
+        }
+    }
+
+    if (ret._container != nullptr)
+    {
+        // _data stays null until the payload has been constructed, so a failed construction never gets destructed
+        ret._container->_typeInfo = typeInfo;
+    }
+
+    return ret;
+}
+
+void DataObject::FreeContainer(DataObjectContainer* container)
+{
+    switch (container->_payloadStorage)
+    {
+    case PayloadStorage::Inline:
+        DestroyPooledContainer(static_cast<InlineDataObjectContainer*>(container));
+        break;
+    case PayloadStorage::CoAllocated:
+    {
+        // Grab the handler first. Freeing the container drops its type info reference.
+        const TypeInfo::FreeContainerHandler freeContainer = container->_typeInfo->_typeOps->freeContainer;
+        freeContainer(container);
+        break;
+    }
+    default:
+        DestroyPooledContainer(container);
+        break;
+    }
+}
+
+void DataObject::DestroyContainer(DataObjectContainer* container)
+{
+    if (container->_payloadStorage == PayloadStorage::Arena)
+    {
+        return;
+    }
+
+    if (!container->_wrapped && container->_data != nullptr)
+    {
+        if (container->_payloadStorage == PayloadStorage::Separate)
+        {
+            container->_typeInfo->Destruct(container->_data);
+        }
+        else
+        {
+            container->_typeInfo->DestructAt(container->_data);
+        }
+    }
+
+    FreeContainer(container);
+}
+
 DataObject::DataObject(const DataObject& other)
     : _container(other._container)
 {
     if (_container != nullptr)
     {
-        ++_container->_refCount;
+        AddRef();
+    }
+}
+
+DataObject::DataObject(UniqueDataObject&& unique, DataObjectRefCountPolicy refCountPolicy)
+    : _container(unique._container)
+{
+    unique._container = nullptr;
+
+    if (_container != nullptr)
+    {
+        _container->_refCountPolicy = refCountPolicy;
     }
 }
 
@@ -44,24 +171,67 @@ DataObject::DataObject(DataObject&& other) noexcept
 
 DataObject::~DataObject() { Release(); }
 
+void DataObject::AddRef()
+{
+    if (_container->_refCountPolicy == DataObjectRefCountPolicy::SingleThreaded)
+    {
+        // Every owner lives on one thread, so a plain read-modify-write is enough and avoids a locked instruction
+        _container->_refCount.store(_container->_refCount.load(std::memory_order_relaxed) + 1,
+                                    std::memory_order_relaxed);
+    }
+    else
+    {
+        ++_container->_refCount;
+    }
+}
+
 void DataObject::Release()
 {
     if (_container)
     {
-        if (--_container->_refCount == 0)
+        int count;
+        if (_container->_refCountPolicy == DataObjectRefCountPolicy::SingleThreaded)
         {
-            if (!_container->_wrapped)
-            {
-                _container->_typeInfo->Destruct(_container->_data);
-            }
+            count = _container->_refCount.load(std::memory_order_relaxed) - 1;
+            _container->_refCount.store(count, std::memory_order_relaxed);
+        }
+        else
+        {
+            count = --_container->_refCount;
+        }
 
-            AllocatorOps::DestroyInstance(_container);
+        if (count == 0)
+        {
+            DestroyContainer(_container);
         }
 
         _container = nullptr;
     }
 }
 
+UniqueDataObject DataObject::TakeUnique()
+{
+    UniqueDataObject ret;
+
+    // An acquire load pairs with the decrements of other owners that have since let go
+    if (_container != nullptr && _container->_refCount.load(std::memory_order_acquire) == 1)
+    {
+        ret._container = _container;
+        _container     = nullptr;
+    }
+
+    return ret;
+}
+
+DataObjectRefCountPolicy DataObject::GetRefCountPolicy() const
+{
+    if (ENTROPY_LIKELY(_container))
+    {
+        return _container->_refCountPolicy;
+    }
+    return DataObjectRefCountPolicy::Atomic;
+}
+
 DataObject& DataObject::operator=(const DataObject& other)
 {
     Release();
@@ -76,6 +246,96 @@ DataObject& DataObject::operator=(DataObject&& other)
     return *this;
 }
 
+DataObject DataObject::Clone() const
+{
+    if (ENTROPY_UNLIKELY(!_container || !_container->_data))
+    {
+        return nullptr;
+    }
+
+    return _container->_typeInfo->DangerousCopyConstruct(_container->_data);
+}
+
+bool DataObject::EnableCopyOnWrite()
+{
+    if (ENTROPY_UNLIKELY(!_container || _container->_wrapped || !_container->_typeInfo->CanCopyConstruct()))
+    {
+        return false;
+    }
+
+    _container->_copyOnWrite = true;
+    return true;
+}
+
+void DataObject::DetachIfShared()
+{
+    // An acquire load pairs with the decrements of other owners that have since let go, like TakeUnique()
+    if (_container->_refCount.load(std::memory_order_acquire) == 1)
+    {
+        return;
+    }
+
+    // The copy keeps the kind of storage of the original instead of following whichever arena is current. Otherwise a
+    // long-lived payload written inside an arena scope would be rebuilt in that arena and dangle once it is reset.
+    DataObject copy;
+    if (_container->_payloadStorage == PayloadStorage::Arena)
+    {
+        DataObjectArena::Scope arenaScope(*static_cast<ArenaDataObjectContainer*>(_container)->_arena);
+        copy = Clone();
+    }
+    else
+    {
+        DataObjectArena::Scope noArenaScope(nullptr);
+        copy = Clone();
+    }
+    ENTROPY_ASSERT(copy);
+
+    if (ENTROPY_LIKELY(copy))
+    {
+        copy._container->_copyOnWrite    = true;
+        copy._container->_refCountPolicy = _container->_refCountPolicy;
+
+        *this = std::move(copy);
+    }
+}
+
 bool DataObject::CanCastTo(const TypeInfo* typeInfo) const { return _container->_typeInfo->CanCastTo(typeInfo); }
 
+//================
+
+UniqueDataObject::~UniqueDataObject() { Reset(); }
+
+UniqueDataObject& UniqueDataObject::operator=(UniqueDataObject&& other) noexcept
+{
+    if (this != &other)
+    {
+        Reset();
+        _container       = other._container;
+        other._container = nullptr;
+    }
+    return *this;
+}
+
+void UniqueDataObject::Reset()
+{
+    if (_container)
+    {
+        // The count is still 1 from when the container was shared. Arena containers are only checked and torn down
+        // when the arena resets, which expects every owner to have let go.
+        _container->_refCount.store(0, std::memory_order_relaxed);
+
+        DataObject::DestroyContainer(_container);
+        _container = nullptr;
+    }
+}
+
+bool UniqueDataObject::CanCastTo(const TypeInfo* typeInfo) const
+{
+    return _container->_typeInfo->CanCastTo(typeInfo);
+}
+
+//================
+
+bool DataObjectView::CanCastTo(const TypeInfo* typeInfo) const { return _typeInfo->CanCastTo(typeInfo); }
+
 } // namespace Entropy
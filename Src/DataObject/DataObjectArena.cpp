@@ -0,0 +1,127 @@
+// Copyright (c) Entropy Software LLC
+// This file is licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+#include "Entropy/Reflection/DataObject/DataObjectArena.h"
+#include "Entropy/Core/Details/AllocatorTraits.h"
+#include "Entropy/Core/Log.h"
+#include "Entropy/Reflection/TypeInfo/TypeInfo.h"
+#include <algorithm>
+#include <new>
+
+namespace Entropy
+{
+
+namespace
+{
+
+thread_local DataObjectArena* tCurrentArena = nullptr;
+
+inline std::size_t AlignUp(std::size_t value, std::size_t alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+} // namespace
+
+DataObjectArena::Scope::Scope(DataObjectArena& arena) noexcept
+    : _previous(tCurrentArena)
+{
+    tCurrentArena = &arena;
+}
+
+DataObjectArena::Scope::Scope(std::nullptr_t) noexcept
+    : _previous(tCurrentArena)
+{
+    tCurrentArena = nullptr;
+}
+
+DataObjectArena::Scope::~Scope() { tCurrentArena = _previous; }
+
+//================
+
+DataObjectArena::~DataObjectArena() { Reset(); }
+
+DataObjectArena* DataObjectArena::GetCurrent() noexcept { return tCurrentArena; }
+
+void DataObjectArena::Reset()
+{
+    // Containers are linked newest first, so payloads are destructed in reverse creation order
+    for (ContainerType* container = _containers; container != nullptr;)
+    {
+        ContainerType* next = container->_nextInArena;
+
+        ENTROPY_ASSERT(container->_refCount.load(std::memory_order_relaxed) == 0);
+
+        if (container->_data != nullptr)
+        {
+            container->_typeInfo->DestructAt(container->_data);
+        }
+        container->~ContainerType();
+
+        container = next;
+    }
+
+    while (_chunks != nullptr)
+    {
+        Chunk* next = _chunks->next;
+        AllocatorOps::DestroyInstance(_chunks);
+        _chunks = next;
+    }
+
+    _containers  = nullptr;
+    _chunkOffset = 0;
+    _objectCount = 0;
+}
+
+void* DataObjectArena::Allocate(std::size_t size, std::size_t alignment)
+{
+    std::size_t offset = AlignUp(_chunkOffset, alignment);
+
+    if (_chunks == nullptr || offset + size > cChunkSize)
+    {
+        Chunk* chunk = AllocatorOps::CreateInstance<Chunk>();
+        if (ENTROPY_UNLIKELY(chunk == nullptr))
+        {
+            return nullptr;
+        }
+
+        chunk->next = _chunks;
+        _chunks     = chunk;
+        offset      = 0;
+    }
+
+    _chunkOffset = offset + size;
+    return reinterpret_cast<byte*>(&_chunks->storage) + offset;
+}
+
+DataObject::DataObjectContainer* DataObjectArena::AllocateContainer(std::size_t payloadSize,
+                                                                    std::size_t payloadAlignment, void** payload)
+{
+    const std::size_t payloadOffset = AlignUp(sizeof(ContainerType), payloadAlignment);
+    const std::size_t blockSize     = payloadOffset + payloadSize;
+
+    if (payloadAlignment > alignof(std::max_align_t) || blockSize > cChunkSize)
+    {
+        return nullptr;
+    }
+
+    void* block = Allocate(blockSize, std::max(alignof(ContainerType), payloadAlignment));
+    if (ENTROPY_UNLIKELY(block == nullptr))
+    {
+        return nullptr;
+    }
+
+    ContainerType* container   = new (block) ContainerType();
+    container->_payloadStorage = DataObject::PayloadStorage::Arena;
+    container->_nextInArena    = _containers;
+    container->_arena          = this;
+
+    _containers = container;
+    ++_objectCount;
+
+    *payload = reinterpret_cast<byte*>(block) + payloadOffset;
+    return container;
+}
+
+} // namespace Entropy
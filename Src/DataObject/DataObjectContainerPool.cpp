@@ -0,0 +1,212 @@
+// Copyright (c) Entropy Software LLC
+// This file is licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+#include "Entropy/Reflection/DataObject/DataObjectContainerPool.h"
+#include "Entropy/Core/Details/AllocatorTraits.h"
+#include <mutex>
+#include <new>
+#include <type_traits>
+
+namespace Entropy
+{
+namespace details
+{
+
+namespace
+{
+
+using Pool = DataObjectContainerPool;
+
+// Overlays a block while it sits in a free list. Only the first block of a batch uses nextBatch / batchCount.
+struct FreeBlock
+{
+    FreeBlock* next        = nullptr;
+    FreeBlock* nextBatch   = nullptr;
+    std::size_t batchCount = 0;
+};
+
+static_assert(sizeof(FreeBlock) <= Pool::cBlockSize, "A free block must fit in a pooled block");
+
+struct Slab
+{
+    // Intentionally leaves the blocks uninitialized
+    Slab() {}
+
+    typename std::aligned_storage<Pool::cBlockSize, Pool::cBlockAlignment>::type blocks[Pool::cBatchSize];
+};
+
+class SharedFreeList
+{
+public:
+    static SharedFreeList& Get()
+    {
+        // Intentionally leaked so containers released from static destructors can still return their blocks
+        static SharedFreeList* list = AllocatorOps::CreateInstance<SharedFreeList>();
+        return *list;
+    }
+
+    void PushBatch(FreeBlock* head, std::size_t count)
+    {
+        head->batchCount = count;
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        head->nextBatch = _batches;
+        _batches        = head;
+    }
+
+    FreeBlock* PopBatch(std::size_t& count)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        FreeBlock* head = _batches;
+        if (head != nullptr)
+        {
+            _batches = head->nextBatch;
+            count    = head->batchCount;
+        }
+        return head;
+    }
+
+private:
+    FreeBlock* _batches = nullptr;
+    std::mutex _mutex;
+};
+
+// Trivially destructible so it stays usable while other thread_local objects are torn down after ThreadCacheFlusher
+struct ThreadCache
+{
+    FreeBlock* head   = nullptr;
+    std::size_t count = 0;
+    bool flushed      = false;
+};
+
+thread_local ThreadCache tCache;
+
+void FlushBatch(ThreadCache& cache, std::size_t count)
+{
+    FreeBlock* head = cache.head;
+    FreeBlock* tail = head;
+    for (std::size_t i = 1; i < count; ++i)
+    {
+        tail = tail->next;
+    }
+
+    cache.head = tail->next;
+    cache.count -= count;
+
+    tail->next = nullptr;
+    SharedFreeList::Get().PushBatch(head, count);
+}
+
+// Hands the cached blocks of an exiting thread back to the shared list
+struct ThreadCacheFlusher
+{
+    ~ThreadCacheFlusher()
+    {
+        while (tCache.count > 0)
+        {
+            FlushBatch(tCache, tCache.count < Pool::cBatchSize ? tCache.count : Pool::cBatchSize);
+        }
+        tCache.flushed = true;
+    }
+
+    bool registered = false;
+};
+
+thread_local ThreadCacheFlusher tCacheFlusher;
+
+FreeBlock* TakeBatch(std::size_t& count)
+{
+    FreeBlock* head = SharedFreeList::Get().PopBatch(count);
+    if (head != nullptr)
+    {
+        return head;
+    }
+
+    Slab* slab = AllocatorOps::CreateInstance<Slab>();
+    if (ENTROPY_UNLIKELY(slab == nullptr))
+    {
+        return nullptr;
+    }
+
+    FreeBlock* next = nullptr;
+    for (std::size_t i = Pool::cBatchSize; i > 0; --i)
+    {
+        FreeBlock* block = new (&slab->blocks[i - 1]) FreeBlock();
+        block->next      = next;
+        next             = block;
+    }
+
+    count = Pool::cBatchSize;
+    return next;
+}
+
+} // namespace
+
+void* DataObjectContainerPool::Allocate()
+{
+    ThreadCache& cache = tCache;
+
+    if (ENTROPY_UNLIKELY(cache.head == nullptr))
+    {
+        std::size_t count = 0;
+        FreeBlock* batch  = TakeBatch(count);
+        if (ENTROPY_UNLIKELY(batch == nullptr))
+        {
+            return nullptr;
+        }
+
+        if (ENTROPY_UNLIKELY(cache.flushed))
+        {
+            // Nothing would hand a cache back anymore, so only keep the block we need
+            if (count > 1)
+            {
+                SharedFreeList::Get().PushBatch(batch->next, count - 1);
+            }
+            return batch;
+        }
+
+        // Touching the flusher makes sure the cache is handed back when this thread exits
+        tCacheFlusher.registered = true;
+
+        cache.head  = batch;
+        cache.count = count;
+    }
+
+    FreeBlock* block = cache.head;
+    cache.head       = block->next;
+    --cache.count;
+
+    return block;
+}
+
+void DataObjectContainerPool::Free(void* block) noexcept
+{
+    ThreadCache& cache   = tCache;
+    FreeBlock* freeBlock = new (block) FreeBlock();
+
+    if (ENTROPY_UNLIKELY(cache.flushed))
+    {
+        SharedFreeList::Get().PushBatch(freeBlock, 1);
+        return;
+    }
+
+    if (cache.head == nullptr)
+    {
+        // A thread that only ever frees still has to hand its cache back when it exits
+        tCacheFlusher.registered = true;
+    }
+
+    freeBlock->next = cache.head;
+    cache.head      = freeBlock;
+    ++cache.count;
+
+    if (cache.count >= 2 * cBatchSize)
+    {
+        FlushBatch(cache, cBatchSize);
+    }
+}
+
+} // namespace details
+} // namespace Entropy
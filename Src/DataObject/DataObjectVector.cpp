@@ -0,0 +1,200 @@
+// Copyright (c) Entropy Software LLC
+// This file is licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+#include "Entropy/Reflection/DataObject/DataObjectVector.h"
+#include "Entropy/Core/Log.h"
+#include "Entropy/Reflection/TypeInfo/TypeInfo.h"
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <utility>
+
+namespace Entropy
+{
+
+DataObjectVector::DataObjectVector(const TypeInfo* typeInfo)
+    : _typeInfo(typeInfo)
+{
+    ENTROPY_ASSERT(typeInfo != nullptr && typeInfo->GetSize() > 0);
+
+    if (ENTROPY_LIKELY(typeInfo != nullptr))
+    {
+        _elementSize          = typeInfo->GetSize();
+        _triviallyRelocatable = typeInfo->IsTriviallyRelocatable();
+    }
+}
+
+DataObjectVector::DataObjectVector(DataObjectVector&& other) noexcept
+    : _typeInfo(std::move(other._typeInfo))
+    , _storage(std::move(other._storage))
+    , _size(other._size)
+    , _capacity(other._capacity)
+    , _elementSize(other._elementSize)
+    , _triviallyRelocatable(other._triviallyRelocatable)
+{
+    other._storage  = VectorOps::VectorType<StorageBlock>{};
+    other._size     = 0;
+    other._capacity = 0;
+}
+
+DataObjectVector& DataObjectVector::operator=(DataObjectVector&& other) noexcept
+{
+    if (this != &other)
+    {
+        this->~DataObjectVector();
+        new (this) DataObjectVector(std::move(other));
+    }
+    return *this;
+}
+
+DataObjectVector::~DataObjectVector()
+{
+    Clear();
+}
+
+bool DataObjectVector::Reserve(std::size_t capacity)
+{
+    if (capacity <= _capacity)
+    {
+        return true;
+    }
+
+    if (ENTROPY_UNLIKELY(_elementSize == 0 || _typeInfo->GetAlignment() > alignof(std::max_align_t) ||
+                         capacity > (SIZE_MAX - sizeof(StorageBlock)) / _elementSize))
+    {
+        return false;
+    }
+
+    const std::size_t blockCount = (capacity * _elementSize + sizeof(StorageBlock) - 1) / sizeof(StorageBlock);
+
+    VectorOps::VectorType<StorageBlock> storage{};
+    for (std::size_t i = 0; i < blockCount; ++i)
+    {
+        VectorOps::Add(storage, StorageBlock{});
+    }
+
+    if (_size > 0)
+    {
+        void* dst = &VectorOps::At(storage, 0);
+        void* src = GetElementPtr(0);
+        if (_triviallyRelocatable)
+        {
+            std::memcpy(dst, src, _size * _elementSize);
+        }
+        else if (_typeInfo->MoveConstructN(dst, src, _size) || _typeInfo->CopyConstructN(dst, src, _size))
+        {
+            _typeInfo->DestructN(src, _size);
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    _storage = std::move(storage);
+
+    // The last block usually has room left over, which is part of the capacity as well
+    _capacity = (blockCount * sizeof(StorageBlock)) / _elementSize;
+    return true;
+}
+
+void* DataObjectVector::PrepareBack()
+{
+    if (_size == _capacity && !Reserve(_capacity < 4 ? 4 : _capacity * 2))
+    {
+        return nullptr;
+    }
+    return GetElementPtr(_size);
+}
+
+bool DataObjectVector::Emplace()
+{
+    void* slot = PrepareBack();
+    if (ENTROPY_UNLIKELY(slot == nullptr || !_typeInfo->ConstructAt(slot)))
+    {
+        return false;
+    }
+
+    ++_size;
+    return true;
+}
+
+bool DataObjectVector::DangerousPushCopy(const void* src)
+{
+    void* slot = PrepareBack();
+    if (ENTROPY_UNLIKELY(slot == nullptr || !_typeInfo->CopyConstructAt(slot, src)))
+    {
+        return false;
+    }
+
+    ++_size;
+    return true;
+}
+
+bool DataObjectVector::DangerousPushMove(void* src)
+{
+    void* slot = PrepareBack();
+    if (ENTROPY_UNLIKELY(slot == nullptr || !_typeInfo->MoveConstructAt(slot, src)))
+    {
+        return false;
+    }
+
+    ++_size;
+    return true;
+}
+
+bool DataObjectVector::Erase(std::size_t index)
+{
+    if (ENTROPY_UNLIKELY(index >= _size))
+    {
+        return false;
+    }
+
+    const std::size_t tailCount = _size - index - 1;
+    if (tailCount > 0 && !_triviallyRelocatable && !_typeInfo->CanMoveConstruct() && !_typeInfo->CanCopyConstruct())
+    {
+        return false;
+    }
+
+    _typeInfo->DestructAt(GetElementPtr(index));
+
+    if (_triviallyRelocatable)
+    {
+        std::memmove(GetElementPtr(index), GetElementPtr(index + 1), tailCount * _elementSize);
+    }
+    else
+    {
+        // The source and destination overlap, so relocate one element at a time into the slot that was just freed
+        for (std::size_t i = index; i < index + tailCount; ++i)
+        {
+            if (!_typeInfo->MoveConstructAt(GetElementPtr(i), GetElementPtr(i + 1)))
+            {
+                _typeInfo->CopyConstructAt(GetElementPtr(i), GetElementPtr(i + 1));
+            }
+            _typeInfo->DestructAt(GetElementPtr(i + 1));
+        }
+    }
+
+    --_size;
+    return true;
+}
+
+void DataObjectVector::PopBack()
+{
+    ENTROPY_ASSERT(_size > 0);
+
+    --_size;
+    _typeInfo->DestructAt(GetElementPtr(_size));
+}
+
+void DataObjectVector::Clear()
+{
+    if (_size > 0)
+    {
+        _typeInfo->DestructN(GetElementPtr(0), _size);
+        _size = 0;
+    }
+}
+
+} // namespace Entropy
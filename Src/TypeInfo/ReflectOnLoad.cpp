@@ -0,0 +1,140 @@
+// Copyright (c) Entropy Software LLC
+// This file is licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+#include "Entropy/Reflection/TypeInfo/ReflectOnLoad.h"
+#include "Entropy/Core/Details/AllocatorTraits.h"
+#include "Entropy/Core/Details/VectorOps.h"
+#include "Entropy/Reflection/TypeInfo/TypeInfo.h"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace Entropy
+{
+
+namespace
+{
+
+struct PendingReflectedType
+{
+    details::ReflectOnLoadFunction reflectFn = nullptr;
+    const TypeInfo* typeInfo                 = nullptr;
+    std::chrono::nanoseconds duration{0};
+};
+
+class PendingReflectedTypeList
+{
+public:
+    static PendingReflectedTypeList& Get()
+    {
+        // Types are added during static initialization, so this must be constructed on first use. Intentionally leaked
+        // so registrations from other static destructors / late loaded libraries never touch a destroyed list.
+        static PendingReflectedTypeList* list = AllocatorOps::CreateInstance<PendingReflectedTypeList>();
+        return *list;
+    }
+
+    void Add(details::ReflectOnLoadFunction reflectFn)
+    {
+        PendingReflectedType pending;
+        pending.reflectFn = reflectFn;
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        VectorOps::Add(_pending, pending);
+    }
+
+    VectorOps::VectorType<PendingReflectedType> TakeAll()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        VectorOps::VectorType<PendingReflectedType> ret{};
+        std::swap(ret, _pending);
+        return ret;
+    }
+
+private:
+    VectorOps::VectorType<PendingReflectedType> _pending{};
+    std::mutex _mutex;
+};
+
+void InitializePendingType(PendingReflectedType& pending)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    pending.typeInfo = pending.reflectFn();
+
+    pending.duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+}
+
+} // namespace
+
+//================
+
+std::size_t InitializeAllReflectedTypes(int threadCount, const ReflectedTypeInitializedHandler& onTypeInitialized)
+{
+    VectorOps::VectorType<PendingReflectedType> pendingTypes = PendingReflectedTypeList::Get().TakeAll();
+    const std::size_t pendingCount                           = VectorOps::GetCount(pendingTypes);
+
+    threadCount = std::min(threadCount, static_cast<int>(pendingCount));
+
+    if (threadCount < 2)
+    {
+        for (std::size_t i = 0; i < pendingCount; ++i)
+        {
+            InitializePendingType(VectorOps::At(pendingTypes, i));
+        }
+    }
+    else
+    {
+        std::atomic<std::size_t> nextIdx{0};
+
+        auto worker = [&]() {
+            for (std::size_t idx = nextIdx++; idx < pendingCount; idx = nextIdx++)
+            {
+                InitializePendingType(VectorOps::At(pendingTypes, idx));
+            }
+        };
+
+        VectorOps::VectorType<std::thread> threads{};
+        for (int t = 1; t < threadCount; ++t)
+        {
+            VectorOps::Add(threads, std::thread(worker));
+        }
+
+        worker();
+
+        for (std::size_t i = 0, count = VectorOps::GetCount(threads); i < count; ++i)
+        {
+            VectorOps::At(threads, i).join();
+        }
+    }
+
+    if (onTypeInitialized)
+    {
+        for (std::size_t i = 0; i < pendingCount; ++i)
+        {
+            const PendingReflectedType& pending = VectorOps::At(pendingTypes, i);
+            onTypeInitialized(pending.typeInfo, pending.duration);
+        }
+    }
+
+    return pendingCount;
+}
+
+namespace details
+{
+
+bool AddPendingReflectedType(ReflectOnLoadFunction reflectFn) noexcept
+{
+    if (ENTROPY_LIKELY(reflectFn))
+    {
+        PendingReflectedTypeList::Get().Add(reflectFn);
+    }
+    return true;
+}
+
+} // namespace details
+
+} // namespace Entropy
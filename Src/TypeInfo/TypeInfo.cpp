@@ -4,6 +4,9 @@
 
 #include "Entropy/Reflection/TypeInfo/TypeInfo.h"
 #include "Entropy/Core/Details/AllocatorTraits.h"
+#include "Entropy/Reflection/TypeInfo/RuntimeReflectionMethods.h"
+#include "Entropy/Reflection/TypeInfo/TypeInfoRegistry.h"
+#include <thread>
 
 namespace Entropy
 {
@@ -18,12 +21,123 @@ void DestroyTypeInfo(const TypeInfo* typeInfo) noexcept
     AllocatorOps::DestroyInstance(const_cast<TypeInfo*>(typeInfo));
 }
 
+namespace
+{
+// Innermost type info the current thread is in the middle of filling
+thread_local const TypeInfoInitializationScope* tInnermostInitializationScope = nullptr;
+} // namespace
+
+TypeInfoInitializationScope::TypeInfoInitializationScope(const TypeInfo* typeInfo) noexcept
+    : typeInfo(typeInfo)
+    , outer(tInnermostInitializationScope)
+{
+    tInnermostInitializationScope = this;
+}
+
+TypeInfoInitializationScope::~TypeInfoInitializationScope() { tInnermostInitializationScope = outer; }
+
+bool TypeInfoInitializationScope::IsFilling(const TypeInfo* typeInfo) noexcept
+{
+    const TypeInfoInitializationScope* scope = tInnermostInitializationScope;
+    while (scope != nullptr)
+    {
+        if (scope->typeInfo == typeInfo)
+        {
+            return true;
+        }
+        scope = scope->outer;
+    }
+    return false;
+}
+
+const TypeInfoInitializationScope* TypeInfoInitializationScope::GetInnermost() noexcept
+{
+    return tInnermostInitializationScope;
+}
+
 } // namespace details
 
 //================
 
-TypeInfo::~TypeInfo() { _modules.~ModuleTypes(); }
+constexpr TypeInfo::CoreData TypeInfo::cEmptyCoreData;
+constexpr TypeInfo::TypeOps TypeInfo::cEmptyTypeOps;
+
+TypeInfo::~TypeInfo()
+{
+    details::UnregisterTypeInfo(this);
+    _modules.~ModuleTypes();
+}
+
+void TypeInfo::WaitForInitialization() const
+{
+    using details::TypeInfoInitializationScope;
+
+    // Re-entrant request while filling this type info. See ReflectTypeAndGetTypeInfo<>().
+    if (TypeInfoInitializationScope::IsFilling(this))
+    {
+        return;
+    }
+
+    // Initialization only runs once per type, so contention here is limited to startup. Yielding keeps this simple
+    // without needing a wait primitive per type info.
+    if (TypeInfoInitializationScope::GetInnermost() == nullptr)
+    {
+        // Nobody can be waiting on a thread that is not filling anything, so there is no cycle to look for
+        while (!IsInitialized())
+        {
+            std::this_thread::yield();
+        }
+        return;
+    }
+
+    // Publish what this thread is blocked on before looking at what other threads are blocked on. Both sides use
+    // sequentially consistent operations, so when two threads start waiting on each other at the same time at least
+    // one of them sees the cycle.
+    SetFillingTypesBlockedOn(this);
+
+    while (!IsInitialized() && !WaitWouldDeadlock())
+    {
+        std::this_thread::yield();
+    }
+
+    SetFillingTypesBlockedOn(nullptr);
+}
+
+bool TypeInfo::WaitWouldDeadlock() const
+{
+    // Each step moves to a different blocked thread, so a chain longer than this is still changing and is rechecked
+    // on the next pass of the wait loop
+    constexpr int cMaxWaitChainLength = 64;
+
+    const TypeInfo* waitingOn = this;
+    for (int i = 0; i < cMaxWaitChainLength; ++i)
+    {
+        waitingOn = waitingOn->_blockedOn.load();
+        if (waitingOn == nullptr)
+        {
+            return false;
+        }
+
+        if (details::TypeInfoInitializationScope::IsFilling(waitingOn))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void TypeInfo::SetFillingTypesBlockedOn(const TypeInfo* typeInfo)
+{
+    const details::TypeInfoInitializationScope* scope = details::TypeInfoInitializationScope::GetInnermost();
+    while (scope != nullptr)
+    {
+        scope->typeInfo->_blockedOn.store(typeInfo);
+        scope = scope->outer;
+    }
+}
 
+#ifndef ENTROPY_REFLECTION_IMMORTAL_TYPEINFO
 void TypeInfo::AddRef() const { ++_refCount; }
 
 void TypeInfo::Release() const
@@ -34,18 +148,29 @@ void TypeInfo::Release() const
         details::DestroyTypeInfo(this);
     }
 }
+#endif
 
 void TypeInfo::SetTypeName(StringOps::StringType&& name) { _typeName = std::move(name); }
 
 void TypeInfo::SetTypeId(TypeId typeId) { _typeId = typeId; }
 
-bool TypeInfo::CanConstruct() const { return (_constructionFn != nullptr); }
+bool TypeInfo::CanConstruct() const { return (_typeOps->construct != nullptr); }
 
 DataObject TypeInfo::Construct() const
 {
     if (ENTROPY_LIKELY(CanConstruct()))
     {
-        void* data = _constructionFn();
+        // Prefer a single allocation for both the container and the payload
+        void* payload  = nullptr;
+        DataObject ret = DataObject::AllocateWithPayload(this, payload);
+        if (ENTROPY_LIKELY(ret))
+        {
+            _typeOps->constructAt(payload);
+            ret.SetPayloadConstructed(payload);
+            return ret;
+        }
+
+        void* data = _typeOps->construct();
         if (ENTROPY_LIKELY(data))
         {
             return DataObject(this, data, false /* wrapped */, DataObject::DataPointerType::AddressOf);
@@ -54,13 +179,23 @@ DataObject TypeInfo::Construct() const
     return nullptr;
 }
 
-bool TypeInfo::CanCopyConstruct() const { return (_copyConstructionFn != nullptr); }
+bool TypeInfo::CanCopyConstruct() const { return (_typeOps->copyConstruct != nullptr); }
 
 DataObject TypeInfo::DangerousCopyConstruct(const void* src) const
 {
     if (ENTROPY_LIKELY(CanCopyConstruct()))
     {
-        void* data = _copyConstructionFn(src);
+        // Prefer a single allocation for both the container and the payload
+        void* payload  = nullptr;
+        DataObject ret = DataObject::AllocateWithPayload(this, payload);
+        if (ENTROPY_LIKELY(ret))
+        {
+            _typeOps->copyConstructAt(payload, src);
+            ret.SetPayloadConstructed(payload);
+            return ret;
+        }
+
+        void* data = _typeOps->copyConstruct(src);
         if (ENTROPY_LIKELY(data))
         {
             return DataObject(this, data, false /* wrapped */, DataObject::DataPointerType::AddressOf);
@@ -69,13 +204,23 @@ DataObject TypeInfo::DangerousCopyConstruct(const void* src) const
     return nullptr;
 }
 
-bool TypeInfo::CanMoveConstruct() const { return (_moveConstructionFn != nullptr); }
+bool TypeInfo::CanMoveConstruct() const { return (_typeOps->moveConstruct != nullptr); }
 
 DataObject TypeInfo::DangerousMoveConstruct(void* src) const
 {
     if (ENTROPY_LIKELY(CanMoveConstruct()))
     {
-        void* data = _moveConstructionFn(src);
+        // Prefer a single allocation for both the container and the payload
+        void* payload  = nullptr;
+        DataObject ret = DataObject::AllocateWithPayload(this, payload);
+        if (ENTROPY_LIKELY(ret))
+        {
+            _typeOps->moveConstructAt(payload, src);
+            ret.SetPayloadConstructed(payload);
+            return ret;
+        }
+
+        void* data = _typeOps->moveConstruct(src);
         if (ENTROPY_LIKELY(data))
         {
             return DataObject(this, data, false /* wrapped */, DataObject::DataPointerType::AddressOf);
@@ -86,49 +231,137 @@ DataObject TypeInfo::DangerousMoveConstruct(void* src) const
 
 void TypeInfo::Destruct(void* dataPtr) const
 {
-    if (ENTROPY_LIKELY(_destructionFn != nullptr))
+    if (ENTROPY_LIKELY(_typeOps->destruct != nullptr))
+    {
+        _typeOps->destruct(dataPtr);
+    }
+}
+
+std::size_t TypeInfo::GetSize() const { return _coreData->size; }
+
+std::size_t TypeInfo::GetAlignment() const { return _coreData->alignment; }
+
+bool TypeInfo::ConstructAt(void* dst) const
+{
+    if (ENTROPY_LIKELY(_typeOps->constructAt != nullptr && dst != nullptr))
     {
-        _destructionFn(dataPtr);
+        _typeOps->constructAt(dst);
+        return true;
     }
+    return false;
 }
 
-void TypeInfo::SetConstructionHandler(ConstructionHandler&& handler) { _constructionFn = std::move(handler); }
+bool TypeInfo::CopyConstructAt(void* dst, const void* src) const
+{
+    if (ENTROPY_LIKELY(_typeOps->copyConstructAt != nullptr && dst != nullptr))
+    {
+        _typeOps->copyConstructAt(dst, src);
+        return true;
+    }
+    return false;
+}
+
+bool TypeInfo::MoveConstructAt(void* dst, void* src) const
+{
+    if (ENTROPY_LIKELY(_typeOps->moveConstructAt != nullptr && dst != nullptr))
+    {
+        _typeOps->moveConstructAt(dst, src);
+        return true;
+    }
+    return false;
+}
+
+void TypeInfo::DestructAt(void* ptr) const
+{
+    if (ENTROPY_LIKELY(_typeOps->destructAt != nullptr && ptr != nullptr))
+    {
+        _typeOps->destructAt(ptr);
+    }
+}
+
+bool TypeInfo::ConstructN(void* dst, std::size_t count) const
+{
+    if (ENTROPY_LIKELY(_typeOps->constructN != nullptr && dst != nullptr))
+    {
+        _typeOps->constructN(dst, count);
+        return true;
+    }
+    return false;
+}
+
+bool TypeInfo::CopyConstructN(void* dst, const void* src, std::size_t count) const
+{
+    if (ENTROPY_LIKELY(_typeOps->copyConstructN != nullptr && dst != nullptr))
+    {
+        _typeOps->copyConstructN(dst, src, count);
+        return true;
+    }
+    return false;
+}
 
-void TypeInfo::SetCopyConstructionHandler(CopyConstructionHandler&& handler)
+bool TypeInfo::MoveConstructN(void* dst, void* src, std::size_t count) const
 {
-    _copyConstructionFn = std::move(handler);
+    if (ENTROPY_LIKELY(_typeOps->moveConstructN != nullptr && dst != nullptr))
+    {
+        _typeOps->moveConstructN(dst, src, count);
+        return true;
+    }
+    return false;
 }
 
-void TypeInfo::SetMoveConstructionHandler(MoveConstructionHandler&& handler)
+void TypeInfo::DestructN(void* ptr, std::size_t count) const
 {
-    _moveConstructionFn = std::move(handler);
+    // Trivially destructible types have no handler at all, so they never pay for the indirect call
+    if (_typeOps->destructN != nullptr && ptr != nullptr)
+    {
+        _typeOps->destructN(ptr, count);
+    }
 }
 
-void TypeInfo::SetDestructionHandler(DestructionHandler&& handler) { _destructionFn = std::move(handler); }
+void TypeInfo::SetTypeOps(const TypeOps* typeOps) { _typeOps = typeOps; }
 
-bool TypeInfo::IsConst() const { return (_flags & Flags::IsConst) != Flags::None; }
+bool TypeInfo::IsConst() const { return (_coreData->flags & Flags::IsConst) != Flags::None; }
 
-bool TypeInfo::IsPointer() const { return (_flags & Flags::IsPointer) != Flags::None; }
+bool TypeInfo::IsPointer() const { return (_coreData->flags & Flags::IsPointer) != Flags::None; }
+
+bool TypeInfo::IsArray() const { return (_coreData->flags & Flags::IsArray) != Flags::None; }
+
+bool TypeInfo::IsPointerOrArray() const
+{
+    return (_coreData->flags & (Flags::IsPointer | Flags::IsArray)) != Flags::None;
+}
 
-bool TypeInfo::IsArray() const { return (_flags & Flags::IsArray) != Flags::None; }
+bool TypeInfo::IsLValueReference() const { return (_coreData->flags & Flags::IsLReference) != Flags::None; }
 
-bool TypeInfo::IsPointerOrArray() const { return (_flags & (Flags::IsPointer | Flags::IsArray)) != Flags::None; }
+bool TypeInfo::IsRValueReference() const { return (_coreData->flags & Flags::IsRReference) != Flags::None; }
 
-bool TypeInfo::IsLValueReference() const { return (_flags & Flags::IsLReference) != Flags::None; }
+bool TypeInfo::IsReference() const
+{
+    return (_coreData->flags & (Flags::IsLReference | Flags::IsRReference)) != Flags::None;
+}
 
-bool TypeInfo::IsRValueReference() const { return (_flags & Flags::IsRReference) != Flags::None; }
+bool TypeInfo::IsTriviallyCopyable() const { return (_coreData->flags & Flags::IsTriviallyCopyable) != Flags::None; }
 
-bool TypeInfo::IsReference() const { return (_flags & (Flags::IsLReference | Flags::IsRReference)) != Flags::None; }
+bool TypeInfo::IsTriviallyDestructible() const
+{
+    return (_coreData->flags & Flags::IsTriviallyDestructible) != Flags::None;
+}
 
-void TypeInfo::SetIsConst() { _flags |= Flags::IsConst; }
+bool TypeInfo::IsStandardLayout() const { return (_coreData->flags & Flags::IsStandardLayout) != Flags::None; }
 
-void TypeInfo::SetIsPointer() { _flags |= Flags::IsPointer; }
+bool TypeInfo::IsTriviallyRelocatable() const
+{
+    return (_coreData->flags & Flags::IsTriviallyRelocatable) != Flags::None;
+}
 
-void TypeInfo::SetIsLReference() { _flags |= Flags::IsLReference; }
+bool TypeInfo::IsEmpty() const { return (_coreData->flags & Flags::IsEmpty) != Flags::None; }
 
-void TypeInfo::SetIsRReference() { _flags |= Flags::IsRReference; }
+bool TypeInfo::IsNothrowMoveConstructible() const
+{
+    return (_coreData->flags & Flags::IsNothrowMoveConstructible) != Flags::None;
+}
 
-void TypeInfo::SetIsArray() { _flags |= Flags::IsArray; }
+void TypeInfo::SetCoreData(const CoreData* coreData) { _coreData = coreData; }
 
 bool TypeInfo::IsQualifiedType() const { return _nextUnqualifiedType; }
 
@@ -141,18 +374,12 @@ const TypeInfo* TypeInfo::GetNextUnqualifiedType() const
     return this;
 }
 
-const TypeInfo* TypeInfo::GetFullyUnqualifiedType() const
-{
-    const TypeInfo* ret = this;
-    while (ret->IsQualifiedType())
-    {
-        ret = ret->GetNextUnqualifiedType();
-    }
-    return ret;
-}
+const TypeInfo* TypeInfo::GetFullyUnqualifiedType() const { return _fullyUnqualifiedType; }
 
 void TypeInfo::SetNextUnqualifiedType(const TypeInfo* typeInfo) { _nextUnqualifiedType = typeInfo; }
 
+void TypeInfo::SetFullyUnqualifiedType(const TypeInfo* typeInfo) { _fullyUnqualifiedType = typeInfo; }
+
 bool TypeInfo::CanCastTo(const TypeInfo* other) const noexcept
 {
     if (ENTROPY_UNLIKELY(other == nullptr))
@@ -166,6 +393,143 @@ bool TypeInfo::CanCastTo(const TypeInfo* other) const noexcept
         return true;
     }
 
+    // Type infos are at least pointer aligned, which leaves the lowest bit free for the result
+    const std::uintptr_t otherBits = reinterpret_cast<std::uintptr_t>(other);
+    std::atomic<std::uintptr_t>& entry = _castCache[((otherBits >> 4) ^ (otherBits >> 10)) & (cCastCacheSize - 1)];
+
+    // The result only depends on immutable data of both type infos, so a relaxed load is enough
+    const std::uintptr_t cached = entry.load(std::memory_order_relaxed);
+    if (ENTROPY_LIKELY((cached & ~std::uintptr_t(1)) == otherBits))
+    {
+        return (cached & 1) != 0;
+    }
+
+    const bool canCast = CanCastToUncached(other);
+
+    // A type info that is still being filled may not have its qualifier chain yet, so its answer can still change
+    if (ENTROPY_LIKELY(IsInitialized() && other->IsInitialized()))
+    {
+        entry.store(otherBits | (canCast ? 1 : 0), std::memory_order_relaxed);
+    }
+
+    return canCast;
+}
+
+namespace
+{
+
+// Any level of the remaining chain is an array
+inline bool HasArrayLevel(std::uint64_t qualifiers)
+{
+    return (qualifiers & 0x4444444444444444ull) != 0;
+}
+
+inline const TypeInfo* NthNextUnqualifiedType(const TypeInfo* typeInfo, int n)
+{
+    for (; n > 0; --n)
+    {
+        typeInfo = typeInfo->GetNextUnqualifiedType();
+    }
+    return typeInfo;
+}
+
+} // namespace
+
+bool TypeInfo::CanCastToUncached(const TypeInfo* other) const noexcept
+{
+    using namespace details;
+
+    static_assert(cQualifierLevelArray == 0x4, "HasArrayLevel() expects the array bit in bit 2 of every level");
+
+    std::uint64_t fromLevels = _coreData->qualifiers;
+    std::uint64_t toLevels   = other->_coreData->qualifiers;
+
+    if (ENTROPY_UNLIKELY(fromLevels == cQualifierSignatureOverflow || toLevels == cQualifierSignatureOverflow))
+    {
+        return CanCastToByWalking(other);
+    }
+
+    // Remove references. When doing the cast in DataObject, we will return a reference anyways.
+    const TypeInfo* from = this;
+    const TypeInfo* to   = other;
+    if ((fromLevels | toLevels) & cQualifierLevelReference)
+    {
+        if (fromLevels & cQualifierLevelReference)
+        {
+            from = _nextUnqualifiedType;
+            fromLevels >>= cQualifierLevelBits;
+        }
+        if (toLevels & cQualifierLevelReference)
+        {
+            to = other->_nextUnqualifiedType;
+            toLevels >>= cQualifierLevelBits;
+        }
+
+        if (from == to)
+        {
+            return true;
+        }
+    }
+
+    for (int depth = 0;; ++depth)
+    {
+        const std::uint64_t fromLevel = fromLevels & cQualifierLevelMask;
+        const std::uint64_t toLevel   = toLevels & cQualifierLevelMask;
+
+        if (fromLevel & cQualifierLevelConst)
+        {
+            // We don't allow removing our const. One caveat is arrays: "const char[]" will be both an array and const,
+            // but "const char*" will be just be a pointer (and const at the next level).
+            const std::uint64_t otherConstLevel =
+                ((fromLevel & cQualifierLevelArray) && (toLevel & cQualifierLevelPointer))
+                    ? (toLevels >> cQualifierLevelBits)
+                    : toLevel;
+
+            if (!(otherConstLevel & cQualifierLevelConst))
+            {
+                return false;
+            }
+        }
+
+        const bool fromIsPointerOrArray = (fromLevel & (cQualifierLevelPointer | cQualifierLevelArray)) != 0;
+        const bool toIsPointer          = (toLevel & cQualifierLevelPointer) != 0;
+        if (!fromIsPointerOrArray && !toIsPointer)
+        {
+            // Compare the base types without any qualifiers we've already checked for
+            return _fullyUnqualifiedType == other->_fullyUnqualifiedType;
+        }
+
+        // Remove one pointer layer. Arrays can be cast to pointers, but not the other way around.
+        if (fromIsPointerOrArray != toIsPointer)
+        {
+            // Mismatch pointer counts
+            return false;
+        }
+
+        fromLevels >>= cQualifierLevelBits;
+        toLevels >>= cQualifierLevelBits;
+
+        // Can't cast more than one array dimension to pointer
+        if (fromLevels & cQualifierLevelArray)
+        {
+            return false;
+        }
+
+        // The signature does not record array extents, so identical chains that still contain an array are the only
+        // case that needs the type infos themselves
+        if (ENTROPY_UNLIKELY(fromLevels == toLevels && HasArrayLevel(fromLevels) &&
+                             _fullyUnqualifiedType == other->_fullyUnqualifiedType))
+        {
+            if (NthNextUnqualifiedType(from, depth + 1) == NthNextUnqualifiedType(to, depth + 1))
+            {
+                return true;
+            }
+        }
+    }
+}
+
+bool TypeInfo::CanCastToByWalking(const TypeInfo* other) const noexcept
+{
     // Remove references. When doing the cast in DataObject, we will return a reference anyways.
     if (IsReference() || other->IsReference())
     {
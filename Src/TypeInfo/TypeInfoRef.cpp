@@ -8,6 +8,8 @@
 namespace Entropy
 {
 
+#ifndef ENTROPY_REFLECTION_IMMORTAL_TYPEINFO
+
 TypeInfoRef::TypeInfoRef(const TypeInfo* ptr)
     : _ptr(ptr)
 {
@@ -51,4 +53,6 @@ TypeInfoRef& TypeInfoRef::operator=(TypeInfoRef&& other)
     return *this;
 }
 
+#endif
+
 } // namespace Entropy
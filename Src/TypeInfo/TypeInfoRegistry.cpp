@@ -0,0 +1,732 @@
+// Copyright (c) Entropy Software LLC
+// This file is licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+#include "Entropy/Reflection/TypeInfo/TypeInfoRegistry.h"
+#include "Entropy/Core/Details/AllocatorTraits.h"
+#include "Entropy/Core/Details/VectorOps.h"
+#include "Entropy/Reflection/TypeInfo/TypeInfo.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <mutex>
+
+namespace Entropy
+{
+
+namespace
+{
+
+constexpr std::size_t cInitialRegistryCapacity      = 1024;
+constexpr std::size_t cNamePoolBlockSize            = 16 * 1024;
+constexpr std::size_t cKeysPerPerfectHashBucket     = 4;
+constexpr std::uint32_t cMaxPerfectHashSeedAttempts = 1 << 16;
+
+inline std::uint64_t MixHash(std::uint64_t h)
+{
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+inline std::uint64_t HashTypeName(const char* name, std::size_t length)
+{
+    // FNV-1a, finalized so the low bits are usable for bucket and slot selection
+    std::uint64_t h = 0xcbf29ce484222325ULL;
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        h ^= static_cast<unsigned char>(name[i]);
+        h *= 0x100000001b3ULL;
+    }
+    return MixHash(h);
+}
+
+// Open addressing hash table that can be read without any locks. Writers are serialized through the registry's mutex.
+// Keys are never removed once they are inserted (unregistering only clears the value), so a reader that finds an empty
+// key knows the probe sequence is over.
+struct TypeIdTable
+{
+    struct Slot
+    {
+        Slot() = default;
+
+        // Slots are only copied while a new table is filled, before any reader can see it
+        Slot(const Slot& other) noexcept
+            : typeId(other.typeId.load(std::memory_order_relaxed))
+            , typeInfo(other.typeInfo.load(std::memory_order_relaxed))
+        {
+        }
+
+        std::atomic<TypeId> typeId{cInvalidTypeId};
+        std::atomic<const TypeInfo*> typeInfo{nullptr};
+    };
+
+    explicit TypeIdTable(std::size_t capacity)
+        : mask(capacity - 1)
+    {
+        for (std::size_t i = 0; i < capacity; ++i)
+        {
+            VectorOps::Add(slots, Slot());
+        }
+    }
+
+    static inline std::size_t Hash(TypeId typeId)
+    {
+        // TypeIds may not be well distributed in the low bits, so mix them before masking.
+        return static_cast<std::size_t>(MixHash(static_cast<std::uint64_t>(std::hash<TypeId>{}(typeId))));
+    }
+
+    const TypeInfo* Find(TypeId typeId) const noexcept
+    {
+        for (std::size_t i = Hash(typeId), probe = 0; probe <= mask; ++i, ++probe)
+        {
+            const Slot& slot = VectorOps::At(slots, i & mask);
+
+            TypeId slotTypeId = slot.typeId.load(std::memory_order_acquire);
+            if (slotTypeId == typeId)
+            {
+                return slot.typeInfo.load(std::memory_order_acquire);
+            }
+
+            if (slotTypeId == cInvalidTypeId)
+            {
+                return nullptr;
+            }
+        }
+        return nullptr;
+    }
+
+    // Returns true if a new key was used
+    bool Insert(TypeId typeId, const TypeInfo* typeInfo) noexcept
+    {
+        for (std::size_t i = Hash(typeId);; ++i)
+        {
+            Slot& slot = VectorOps::At(slots, i & mask);
+
+            TypeId slotTypeId = slot.typeId.load(std::memory_order_relaxed);
+            if (slotTypeId == typeId)
+            {
+                // The first registered type info wins. The same type can be registered again once it was unregistered.
+                if (slot.typeInfo.load(std::memory_order_relaxed) == nullptr)
+                {
+                    slot.typeInfo.store(typeInfo, std::memory_order_release);
+                }
+                return false;
+            }
+
+            if (slotTypeId == cInvalidTypeId)
+            {
+                // Publish the value before the key so readers never see a key without its value
+                slot.typeInfo.store(typeInfo, std::memory_order_relaxed);
+                slot.typeId.store(typeId, std::memory_order_release);
+                return true;
+            }
+        }
+    }
+
+    void Remove(TypeId typeId, const TypeInfo* typeInfo) noexcept
+    {
+        for (std::size_t i = Hash(typeId), probe = 0; probe <= mask; ++i, ++probe)
+        {
+            Slot& slot = VectorOps::At(slots, i & mask);
+
+            TypeId slotTypeId = slot.typeId.load(std::memory_order_relaxed);
+            if (slotTypeId == typeId)
+            {
+                const TypeInfo* expected = typeInfo;
+                slot.typeInfo.compare_exchange_strong(expected, nullptr, std::memory_order_release);
+                return;
+            }
+
+            if (slotTypeId == cInvalidTypeId)
+            {
+                return;
+            }
+        }
+    }
+
+    inline std::size_t GetCapacity() const { return mask + 1; }
+
+    VectorOps::VectorType<Slot> slots{};
+    std::size_t mask  = 0;
+    std::size_t count = 0;
+
+    // Tables are never freed while the process is running because a reader may still be probing an older table.
+    TypeIdTable* previous = nullptr;
+};
+
+// Owns the characters of every interned type name. Blocks are never freed, so interned names stay valid for the life of
+// the process.
+class TypeNamePool
+{
+public:
+    // Returns null if the storage could not be allocated
+    const char* Intern(const char* name, std::size_t length)
+    {
+        const std::size_t required = length + 1;
+
+        char* ret = nullptr;
+        if (ENTROPY_UNLIKELY(required > cNamePoolBlockSize))
+        {
+            // Too long to share a block, so it gets storage of its own
+            VectorOps::VectorType<char>* chars = AllocatorOps::CreateInstance<VectorOps::VectorType<char>>();
+            if (ENTROPY_UNLIKELY(chars == nullptr))
+            {
+                return nullptr;
+            }
+
+            for (std::size_t i = 0; i < required; ++i)
+            {
+                VectorOps::Add(*chars, '\0');
+            }
+            ret = &VectorOps::At(*chars, 0);
+        }
+        else
+        {
+            if (required > _remaining)
+            {
+                Block* block = AllocatorOps::CreateInstance<Block>();
+                if (ENTROPY_UNLIKELY(block == nullptr))
+                {
+                    return nullptr;
+                }
+
+                _next      = block->chars;
+                _remaining = cNamePoolBlockSize;
+            }
+
+            ret = _next;
+            _next += required;
+            _remaining -= required;
+        }
+
+        std::memcpy(ret, name, length);
+        ret[length] = '\0';
+
+        return ret;
+    }
+
+private:
+    struct Block
+    {
+        // Intentionally leaves the characters uninitialized
+        Block() {}
+
+        char chars[cNamePoolBlockSize];
+    };
+
+    char* _next            = nullptr;
+    std::size_t _remaining = 0;
+};
+
+struct TypeNameEntry
+{
+    inline bool Matches(std::uint64_t nameHash, const char* otherName, std::size_t otherLength) const
+    {
+        return (hash == nameHash) && (length == otherLength) && (std::memcmp(name, otherName, length) == 0);
+    }
+
+    const char* name   = nullptr;
+    std::size_t length = 0;
+    std::uint64_t hash = 0;
+    std::atomic<const TypeInfo*> typeInfo{nullptr};
+};
+
+// Growable name -> entry table with the same lock-free read rules as TypeIdTable. Entries are never removed, so an
+// empty slot ends the probe sequence.
+struct TypeNameTable
+{
+    struct Slot
+    {
+        Slot() = default;
+
+        // See TypeIdTable::Slot
+        Slot(const Slot& other) noexcept
+            : entry(other.entry.load(std::memory_order_relaxed))
+        {
+        }
+
+        std::atomic<const TypeNameEntry*> entry{nullptr};
+    };
+
+    explicit TypeNameTable(std::size_t capacity)
+        : mask(capacity - 1)
+    {
+        for (std::size_t i = 0; i < capacity; ++i)
+        {
+            VectorOps::Add(slots, Slot());
+        }
+    }
+
+    const TypeNameEntry* Find(std::uint64_t hash, const char* name, std::size_t length) const noexcept
+    {
+        for (std::size_t i = static_cast<std::size_t>(hash), probe = 0; probe <= mask; ++i, ++probe)
+        {
+            const TypeNameEntry* entry = VectorOps::At(slots, i & mask).entry.load(std::memory_order_acquire);
+            if (entry == nullptr)
+            {
+                return nullptr;
+            }
+
+            if (entry->Matches(hash, name, length))
+            {
+                return entry;
+            }
+        }
+        return nullptr;
+    }
+
+    void Insert(const TypeNameEntry* entry) noexcept
+    {
+        for (std::size_t i = static_cast<std::size_t>(entry->hash);; ++i)
+        {
+            std::atomic<const TypeNameEntry*>& slot = VectorOps::At(slots, i & mask).entry;
+            if (slot.load(std::memory_order_relaxed) == nullptr)
+            {
+                slot.store(entry, std::memory_order_release);
+                ++count;
+                return;
+            }
+        }
+    }
+
+    inline std::size_t GetCapacity() const { return mask + 1; }
+
+    VectorOps::VectorType<Slot> slots{};
+    std::size_t mask  = 0;
+    std::size_t count = 0;
+
+    // See TypeIdTable::previous
+    TypeNameTable* previous = nullptr;
+};
+
+// Minimal perfect hash built with hash-and-displace: keys are split into small buckets by their hash, then each bucket
+// (largest first) searches for a seed that places all of its keys into unused slots. A lookup is one bucket read, one
+// slot read and one compare.
+struct FrozenTypeNameTable
+{
+    // Keys grouped by bucket in one flat array: bucket i holds entries[starts[i]] up to entries[starts[i + 1]]
+    struct Buckets
+    {
+        VectorOps::VectorType<const TypeNameEntry*> entries{};
+        VectorOps::VectorType<std::size_t> starts{};
+        VectorOps::VectorType<std::size_t> order{};
+    };
+
+    static inline std::size_t GetSlot(std::uint64_t hash, std::uint32_t seed, std::size_t slotCount)
+    {
+        return static_cast<std::size_t>(MixHash(hash ^ (static_cast<std::uint64_t>(seed) * 0x9e3779b97f4a7c15ULL)) %
+                                        slotCount);
+    }
+
+    inline std::size_t GetBucket(std::uint64_t hash) const
+    {
+        return static_cast<std::size_t>((hash >> 32) % bucketCount);
+    }
+
+    const TypeNameEntry* Find(std::uint64_t hash, const char* name, std::size_t length) const noexcept
+    {
+        const std::uint32_t seed   = VectorOps::At(seeds, GetBucket(hash));
+        const TypeNameEntry* entry = VectorOps::At(slots, GetSlot(hash, seed, slotCount));
+
+        if (entry && entry->Matches(hash, name, length))
+        {
+            return entry;
+        }
+        return nullptr;
+    }
+
+    static FrozenTypeNameTable* Build(const VectorOps::VectorType<const TypeNameEntry*>& entries)
+    {
+        FrozenTypeNameTable* table = AllocatorOps::CreateInstance<FrozenTypeNameTable>();
+        if (ENTROPY_UNLIKELY(table == nullptr))
+        {
+            return nullptr;
+        }
+
+        const std::size_t entryCount = VectorOps::GetCount(entries);
+
+        table->bucketCount = std::max<std::size_t>(1, entryCount / cKeysPerPerfectHashBucket);
+        for (std::size_t i = 0; i < table->bucketCount; ++i)
+        {
+            VectorOps::Add(table->seeds, 0u);
+        }
+
+        // Counting sort of the keys by bucket. Each start is first advanced to the end of its bucket, then walked
+        // back while the bucket is filled.
+        Buckets buckets;
+        for (std::size_t i = 0; i <= table->bucketCount; ++i)
+        {
+            VectorOps::Add(buckets.starts, static_cast<std::size_t>(0));
+        }
+        for (std::size_t i = 0; i < entryCount; ++i)
+        {
+            ++VectorOps::At(buckets.starts, table->GetBucket(VectorOps::At(entries, i)->hash));
+        }
+        for (std::size_t i = 1; i <= table->bucketCount; ++i)
+        {
+            VectorOps::At(buckets.starts, i) += VectorOps::At(buckets.starts, i - 1);
+        }
+        for (std::size_t i = 0; i < entryCount; ++i)
+        {
+            VectorOps::Add(buckets.entries, static_cast<const TypeNameEntry*>(nullptr));
+        }
+        for (std::size_t i = 0; i < entryCount; ++i)
+        {
+            const TypeNameEntry* entry = VectorOps::At(entries, i);
+            VectorOps::At(buckets.entries, --VectorOps::At(buckets.starts, table->GetBucket(entry->hash))) = entry;
+        }
+
+        for (std::size_t i = 0; i < table->bucketCount; ++i)
+        {
+            VectorOps::Add(buckets.order, i);
+        }
+
+        const auto getBucketSize = [&](std::size_t bucketIdx) {
+            return VectorOps::At(buckets.starts, bucketIdx + 1) - VectorOps::At(buckets.starts, bucketIdx);
+        };
+        std::size_t* firstOrder = &VectorOps::At(buckets.order, 0);
+        std::sort(firstOrder, firstOrder + table->bucketCount,
+                  [&](std::size_t a, std::size_t b) { return getBucketSize(a) > getBucketSize(b); });
+
+        // Start minimal. If a bucket cannot be placed, loosen the table a little and try again. The result is still a
+        // perfect hash; it just has a few empty slots.
+        const std::size_t minSlotCount = std::max<std::size_t>(1, entryCount);
+        for (table->slotCount = minSlotCount; table->slotCount <= minSlotCount * 4;
+             table->slotCount += table->slotCount / 16 + 1)
+        {
+            if (table->TryPlace(buckets))
+            {
+                return table;
+            }
+        }
+
+        // Only reachable if two different names share a 64-bit hash. Lookups keep using the growable table.
+        AllocatorOps::DestroyInstance(table);
+        return nullptr;
+    }
+
+    bool TryPlace(const Buckets& buckets)
+    {
+        slots = VectorOps::VectorType<const TypeNameEntry*>();
+        for (std::size_t i = 0; i < slotCount; ++i)
+        {
+            VectorOps::Add(slots, static_cast<const TypeNameEntry*>(nullptr));
+        }
+
+        for (std::size_t orderIdx = 0; orderIdx < bucketCount; ++orderIdx)
+        {
+            const std::size_t bucketIdx = VectorOps::At(buckets.order, orderIdx);
+            const std::size_t first     = VectorOps::At(buckets.starts, bucketIdx);
+            const std::size_t last      = VectorOps::At(buckets.starts, bucketIdx + 1);
+            if (first == last)
+            {
+                break;
+            }
+
+            bool found = false;
+            for (std::uint32_t seed = 0; !found && seed < cMaxPerfectHashSeedAttempts; ++seed)
+            {
+                // Claim slots as we go, and give them back if a later key of the bucket collides
+                std::size_t placed = first;
+                for (; placed < last; ++placed)
+                {
+                    const TypeNameEntry* entry = VectorOps::At(buckets.entries, placed);
+                    const TypeNameEntry*& slot = VectorOps::At(slots, GetSlot(entry->hash, seed, slotCount));
+                    if (slot != nullptr)
+                    {
+                        break;
+                    }
+                    slot = entry;
+                }
+
+                found = (placed == last);
+                if (found)
+                {
+                    VectorOps::At(seeds, bucketIdx) = seed;
+                }
+                else
+                {
+                    for (std::size_t i = first; i < placed; ++i)
+                    {
+                        const TypeNameEntry* entry = VectorOps::At(buckets.entries, i);
+                        VectorOps::At(slots, GetSlot(entry->hash, seed, slotCount)) = nullptr;
+                    }
+                }
+            }
+
+            if (!found)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    VectorOps::VectorType<std::uint32_t> seeds{};
+    std::size_t bucketCount = 0;
+
+    VectorOps::VectorType<const TypeNameEntry*> slots{};
+    std::size_t slotCount = 0;
+
+    // See TypeIdTable::previous
+    FrozenTypeNameTable* previous = nullptr;
+};
+
+class TypeInfoRegistry
+{
+public:
+    static TypeInfoRegistry& Get()
+    {
+        // Intentionally leaked. Type infos unregister themselves during static destruction, so the registry must
+        // outlive all of them.
+        static TypeInfoRegistry* registry = AllocatorOps::CreateInstance<TypeInfoRegistry>();
+        return *registry;
+    }
+
+    TypeInfoRegistry()
+    {
+        _table.store(AllocatorOps::CreateInstance<TypeIdTable>(cInitialRegistryCapacity));
+        _nameTable.store(AllocatorOps::CreateInstance<TypeNameTable>(cInitialRegistryCapacity));
+    }
+
+    inline const TypeInfo* Find(TypeId typeId) const noexcept
+    {
+        return _table.load(std::memory_order_acquire)->Find(typeId);
+    }
+
+    const TypeInfo* FindByName(const char* name, std::size_t length) const noexcept
+    {
+        const std::uint64_t hash = HashTypeName(name, length);
+
+        const FrozenTypeNameTable* frozenTable = _frozenNameTable.load(std::memory_order_acquire);
+        if (ENTROPY_LIKELY(frozenTable != nullptr))
+        {
+            if (const TypeNameEntry* entry = frozenTable->Find(hash, name, length))
+            {
+                return entry->typeInfo.load(std::memory_order_acquire);
+            }
+        }
+
+        // Either we haven't been frozen yet or the name was registered after the last freeze
+        if (const TypeNameEntry* entry = _nameTable.load(std::memory_order_acquire)->Find(hash, name, length))
+        {
+            return entry->typeInfo.load(std::memory_order_acquire);
+        }
+
+        return nullptr;
+    }
+
+    void Register(const TypeInfo* typeInfo) noexcept
+    {
+        std::lock_guard<std::mutex> lock(_writeMutex);
+
+        TypeIdTable* table = _table.load(std::memory_order_relaxed);
+
+        // Keep the load factor at or below 50% so probe sequences stay short
+        if ((table->count + 1) * 2 > table->GetCapacity())
+        {
+            table = Grow(table);
+        }
+
+        if (table->Insert(typeInfo->GetTypeId(), typeInfo))
+        {
+            ++table->count;
+        }
+
+        RegisterName(typeInfo);
+    }
+
+    void Unregister(const TypeInfo* typeInfo) noexcept
+    {
+        std::lock_guard<std::mutex> lock(_writeMutex);
+
+        _table.load(std::memory_order_relaxed)->Remove(typeInfo->GetTypeId(), typeInfo);
+
+        const char* name   = StringOps::GetStr(typeInfo->GetTypeName());
+        std::size_t length = std::strlen(name);
+
+        const TypeNameEntry* entry =
+            _nameTable.load(std::memory_order_relaxed)->Find(HashTypeName(name, length), name, length);
+        if (entry)
+        {
+            const TypeInfo* expected = typeInfo;
+            const_cast<TypeNameEntry*>(entry)->typeInfo.compare_exchange_strong(expected, nullptr,
+                                                                                std::memory_order_release);
+        }
+    }
+
+    void Freeze() noexcept
+    {
+        std::lock_guard<std::mutex> lock(_writeMutex);
+
+        FrozenTypeNameTable* frozenTable = FrozenTypeNameTable::Build(_nameEntries);
+        if (ENTROPY_UNLIKELY(frozenTable == nullptr))
+        {
+            return;
+        }
+
+        frozenTable->previous = _frozenNameTable.load(std::memory_order_relaxed);
+        _frozenNameTable.store(frozenTable, std::memory_order_release);
+    }
+
+private:
+    void RegisterName(const TypeInfo* typeInfo)
+    {
+        const char* name   = StringOps::GetStr(typeInfo->GetTypeName());
+        std::size_t length = std::strlen(name);
+        std::uint64_t hash = HashTypeName(name, length);
+
+        TypeNameTable* nameTable = _nameTable.load(std::memory_order_relaxed);
+
+        if (const TypeNameEntry* entry = nameTable->Find(hash, name, length))
+        {
+            // Same rule as type ids: the first registered type info wins, but a name can be reused once unregistered
+            const TypeInfo* expected = nullptr;
+            const_cast<TypeNameEntry*>(entry)->typeInfo.compare_exchange_strong(expected, typeInfo,
+                                                                                std::memory_order_release);
+            return;
+        }
+
+        const char* internedName = _namePool.Intern(name, length);
+        if (ENTROPY_UNLIKELY(internedName == nullptr))
+        {
+            return;
+        }
+
+        TypeNameEntry* entry = AllocatorOps::CreateInstance<TypeNameEntry>();
+        if (ENTROPY_UNLIKELY(entry == nullptr))
+        {
+            return;
+        }
+
+        entry->name   = internedName;
+        entry->length = length;
+        entry->hash   = hash;
+        entry->typeInfo.store(typeInfo, std::memory_order_relaxed);
+
+        VectorOps::Add(_nameEntries, static_cast<const TypeNameEntry*>(entry));
+
+        if ((nameTable->count + 1) * 2 > nameTable->GetCapacity())
+        {
+            nameTable = GrowNames(nameTable);
+        }
+
+        nameTable->Insert(entry);
+    }
+
+    TypeNameTable* GrowNames(TypeNameTable* nameTable)
+    {
+        TypeNameTable* newTable = AllocatorOps::CreateInstance<TypeNameTable>(nameTable->GetCapacity() * 2);
+
+        for (std::size_t i = 0, count = VectorOps::GetCount(_nameEntries); i < count; ++i)
+        {
+            newTable->Insert(VectorOps::At(_nameEntries, i));
+        }
+
+        newTable->previous = nameTable;
+        _nameTable.store(newTable, std::memory_order_release);
+
+        return newTable;
+    }
+
+    TypeIdTable* Grow(TypeIdTable* table)
+    {
+        TypeIdTable* newTable = AllocatorOps::CreateInstance<TypeIdTable>(table->GetCapacity() * 2);
+
+        for (std::size_t i = 0; i <= table->mask; ++i)
+        {
+            const TypeIdTable::Slot& slot = VectorOps::At(table->slots, i);
+
+            TypeId typeId = slot.typeId.load(std::memory_order_relaxed);
+            if (typeId != cInvalidTypeId)
+            {
+                const TypeInfo* typeInfo = slot.typeInfo.load(std::memory_order_relaxed);
+                if (typeInfo && newTable->Insert(typeId, typeInfo))
+                {
+                    ++newTable->count;
+                }
+            }
+        }
+
+        newTable->previous = table;
+        _table.store(newTable, std::memory_order_release);
+
+        return newTable;
+    }
+
+    std::atomic<TypeIdTable*> _table{nullptr};
+    std::atomic<TypeNameTable*> _nameTable{nullptr};
+    std::atomic<FrozenTypeNameTable*> _frozenNameTable{nullptr};
+
+    // Only touched while holding _writeMutex
+    TypeNamePool _namePool;
+    VectorOps::VectorType<const TypeNameEntry*> _nameEntries{};
+
+    std::mutex _writeMutex;
+};
+
+} // namespace
+
+//================
+
+const TypeInfo* FindTypeById(TypeId typeId) noexcept
+{
+    if (ENTROPY_UNLIKELY(typeId == cInvalidTypeId))
+    {
+        return nullptr;
+    }
+
+    return TypeInfoRegistry::Get().Find(typeId);
+}
+
+const TypeInfo* FindTypeByName(const char* typeName, std::size_t length) noexcept
+{
+    if (ENTROPY_UNLIKELY(typeName == nullptr))
+    {
+        return nullptr;
+    }
+
+    return TypeInfoRegistry::Get().FindByName(typeName, length);
+}
+
+const TypeInfo* FindTypeByName(const char* typeName) noexcept
+{
+    if (ENTROPY_UNLIKELY(typeName == nullptr))
+    {
+        return nullptr;
+    }
+
+    return TypeInfoRegistry::Get().FindByName(typeName, std::strlen(typeName));
+}
+
+void FreezeRegistry() noexcept { TypeInfoRegistry::Get().Freeze(); }
+
+namespace details
+{
+
+void RegisterTypeInfo(const TypeInfo* typeInfo) noexcept
+{
+    if (ENTROPY_LIKELY(typeInfo && typeInfo->GetTypeId() != cInvalidTypeId))
+    {
+        TypeInfoRegistry::Get().Register(typeInfo);
+    }
+}
+
+void UnregisterTypeInfo(const TypeInfo* typeInfo) noexcept
+{
+    if (ENTROPY_LIKELY(typeInfo && typeInfo->GetTypeId() != cInvalidTypeId))
+    {
+        TypeInfoRegistry::Get().Unregister(typeInfo);
+    }
+}
+
+} // namespace details
+
+} // namespace Entropy
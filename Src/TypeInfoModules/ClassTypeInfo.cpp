@@ -4,23 +4,160 @@
 
 #include "Entropy/Reflection/TypeInfoModules/ClassTypeInfo.h"
 #include "Entropy/Core/Details/AllocatorTraits.h"
-#include "Entropy/Core/Details/MapOps.h"
 #include "Entropy/Reflection/TypeInfo/TypeInfo.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
 
 namespace Entropy
 {
 namespace Reflection
 {
 
-AttributeData::AttributeData(DataObject&& dataObj)
-    : _dataObj(std::move(dataObj))
+namespace
 {
+
+constexpr std::size_t cMinMemberNameIndexSize = 8;
+
+inline std::uint32_t HashMemberName(const char* name, std::size_t length)
+{
+    // FNV-1a, with the high bits folded in because the index only looks at the low bits
+    std::uint32_t h = 2166136261u;
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        h ^= static_cast<unsigned char>(name[i]);
+        h *= 16777619u;
+    }
+    return h ^ (h >> 16);
+}
+
+inline bool AttributeTypeIdLess(const AttributeData& lhs, TypeId rhs)
+{
+    return std::less<TypeId>{}(lhs.GetTypeId(), rhs);
+}
+
+inline bool AttributeTypeIdOrder(const AttributeData& lhs, const AttributeData& rhs)
+{
+    return std::less<TypeId>{}(lhs.GetTypeId(), rhs.GetTypeId());
+}
+
+inline std::size_t AlignUp(std::size_t value, std::size_t alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+} // namespace
+
+constexpr std::size_t AttributeStorage::cBlockSize;
+constexpr std::size_t AttributeContainer::cLinearSearchAttributeCount;
+
+AttributeStorage::~AttributeStorage()
+{
+    for (std::size_t i = VectorOps::GetCount(_attributes); i > 0; --i)
+    {
+        const AttributeData& data = VectorOps::At(_attributes, i - 1);
+        data.GetTypeInfo()->DestructAt(const_cast<void*>(data.GetData<void>()));
+    }
+
+    while (_blocks != nullptr)
+    {
+        Block* next = _blocks->next;
+        AllocatorOps::DestroyInstance(_blocks);
+        _blocks = next;
+    }
+}
+
+void* AttributeStorage::Allocate(std::size_t size, std::size_t alignment)
+{
+    if (ENTROPY_UNLIKELY(size > cBlockSize || alignment > alignof(std::max_align_t)))
+    {
+        return nullptr;
+    }
+
+    std::size_t offset = AlignUp(_blockOffset, alignment);
+
+    if (_blocks == nullptr || offset + size > cBlockSize)
+    {
+        Block* block = AllocatorOps::CreateInstance<Block>();
+        if (ENTROPY_UNLIKELY(block == nullptr))
+        {
+            return nullptr;
+        }
+
+        block->next = _blocks;
+        _blocks     = block;
+        offset      = 0;
+    }
+
+    _blockOffset = offset + size;
+    return reinterpret_cast<byte*>(&_blocks->storage) + offset;
 }
 
 //=======================
 
 AttributeContainer::~AttributeContainer() {}
 
+void AttributeContainer::AppendAttribute(AttributeStorage& storage, const AttributeData& data)
+{
+    if (_attributeCount == 0)
+    {
+        _attributeStorage = &storage;
+        _attributeOffset  = static_cast<std::uint32_t>(VectorOps::GetCount(storage._attributes));
+    }
+
+    // Runs are only ever appended to while their owner is being filled, so this one is still at the end
+    ENTROPY_ASSERT(_attributeStorage == &storage &&
+                   _attributeOffset + _attributeCount == VectorOps::GetCount(storage._attributes));
+
+    for (std::uint32_t i = _attributeOffset; i < _attributeOffset + _attributeCount; ++i)
+    {
+        AttributeData& existing = VectorOps::At(storage._attributes, i);
+        if (existing.GetTypeId() == data.GetTypeId())
+        {
+            existing.GetTypeInfo()->DestructAt(const_cast<void*>(existing.GetData<void>()));
+            existing = data;
+            return;
+        }
+    }
+
+    VectorOps::Add(storage._attributes, data);
+    ++_attributeCount;
+}
+
+void AttributeContainer::SortAttributes(AttributeStorage& storage)
+{
+    if (_attributeCount > 1)
+    {
+        AttributeData* first = &VectorOps::At(storage._attributes, _attributeOffset);
+        std::sort(first, first + _attributeCount, AttributeTypeIdOrder);
+    }
+}
+
+const AttributeData* AttributeContainer::FindAttributeSorted(const AttributeRange& attributes, TypeId typeId)
+{
+    const AttributeData* it = std::lower_bound(attributes.begin(), attributes.end(), typeId, AttributeTypeIdLess);
+
+    if (it != attributes.end() && it->GetTypeId() == typeId)
+    {
+        return it;
+    }
+
+    return nullptr;
+}
+
+//=======================
+
+const MemberDescription* FlattenedMember::GetMemberDescription() const
+{
+    if (ENTROPY_UNLIKELY(_declaringClassDesc == nullptr))
+    {
+        return nullptr;
+    }
+
+    return &VectorOps::At(_declaringClassDesc->GetMembers(), _memberIndex);
+}
+
 //=======================
 
 void ClassDescription::AddTemplateParameter(const TypeInfo* templateParameter)
@@ -30,9 +167,100 @@ void ClassDescription::AddTemplateParameter(const TypeInfo* templateParameter)
 
 void ClassDescription::SetBaseClass(const TypeInfo* baseClass) { _baseClassTypeInfo = baseClass; }
 
-void ClassDescription::AddMember(const char* name, MemberDescription&& memberInfo)
+void ClassDescription::AddMember(MemberDescription&& memberInfo)
 {
-    MapOps::AddUnique(_members, name, std::move(memberInfo));
+    const char* name         = memberInfo.GetMemberName();
+    const std::size_t length = memberInfo.GetMemberNameLength();
+
+    // The first member with a name wins
+    if (FindMember(name, length) != nullptr)
+    {
+        return;
+    }
+
+    const std::uint32_t index = static_cast<std::uint32_t>(VectorOps::GetCount(_members));
+    VectorOps::Add(_members, std::move(memberInfo));
+
+    // Keep the index at most half full so probe sequences stay short and always end on an empty slot
+    const std::size_t indexSize = VectorOps::GetCount(_memberNameIndex);
+    if ((index + 1) * 2 > indexSize)
+    {
+        VectorOps::VectorType<MemberNameSlot> oldIndex{};
+        std::swap(oldIndex, _memberNameIndex);
+
+        for (std::size_t i = 0, count = std::max(cMinMemberNameIndexSize, indexSize * 2); i < count; ++i)
+        {
+            VectorOps::Add(_memberNameIndex, MemberNameSlot());
+        }
+
+        for (std::size_t i = 0; i < indexSize; ++i)
+        {
+            const MemberNameSlot& slot = VectorOps::At(oldIndex, i);
+            if (slot.index != 0)
+            {
+                InsertMemberName(slot);
+            }
+        }
+    }
+
+    MemberNameSlot slot;
+    slot.hash  = HashMemberName(name, length);
+    slot.index = index + 1;
+    InsertMemberName(slot);
+}
+
+void ClassDescription::SetMemberLayout(const char* name, const MemberLayout& layout)
+{
+    MemberDescription* member = const_cast<MemberDescription*>(FindMember(name));
+    if (ENTROPY_LIKELY(member != nullptr))
+    {
+        member->SetLayout(layout);
+    }
+}
+
+void ClassDescription::AddFlattenedMember(FlattenedMember&& member) { VectorOps::Add(_allMembers, std::move(member)); }
+
+void ClassDescription::InsertMemberName(const MemberNameSlot& slot)
+{
+    const std::size_t mask = VectorOps::GetCount(_memberNameIndex) - 1;
+    for (std::size_t i = slot.hash & mask;; i = (i + 1) & mask)
+    {
+        MemberNameSlot& entry = VectorOps::At(_memberNameIndex, i);
+        if (entry.index == 0)
+        {
+            entry = slot;
+            return;
+        }
+    }
+}
+
+const MemberDescription* ClassDescription::FindMember(const char* name, std::size_t length) const
+{
+    const std::size_t indexSize = VectorOps::GetCount(_memberNameIndex);
+    if (indexSize == 0)
+    {
+        return nullptr;
+    }
+
+    const std::uint32_t hash = HashMemberName(name, length);
+    const std::size_t mask   = indexSize - 1;
+    for (std::size_t i = hash & mask;; i = (i + 1) & mask)
+    {
+        const MemberNameSlot& slot = VectorOps::At(_memberNameIndex, i);
+        if (slot.index == 0)
+        {
+            return nullptr;
+        }
+
+        if (slot.hash == hash)
+        {
+            const MemberDescription& member = VectorOps::At(_members, slot.index - 1);
+            if (member.GetMemberNameLength() == length && std::memcmp(member.GetMemberName(), name, length) == 0)
+            {
+                return &member;
+            }
+        }
+    }
 }
 
 //=======================
@@ -0,0 +1,104 @@
+// Copyright (c) Entropy Software LLC
+// This file is licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+#include "Entropy/Core/Log.h"
+#include "Entropy/Reflection.h"
+#include "TestMacros.h"
+#include <string>
+
+namespace Entropy
+{
+namespace Tests
+{
+namespace DataObject
+{
+
+struct MyCopyOnWriteTestStruct
+{
+    static int copyCount;
+
+    MyCopyOnWriteTestStruct() = default;
+    MyCopyOnWriteTestStruct(const MyCopyOnWriteTestStruct& other)
+        : value(other.value)
+        , name(other.name)
+    {
+        ++copyCount;
+    }
+
+    int value = 1;
+    std::string name{"snapshot"};
+};
+
+int MyCopyOnWriteTestStruct::copyCount = 0;
+
+} // namespace DataObject
+} // namespace Tests
+} // namespace Entropy
+
+int DataObject_TestCopyOnWrite(int argc, char** const argv)
+{
+    using namespace Entropy;
+    using namespace Entropy::Tests::DataObject;
+
+    Entropy::DataObject original = DataObjectFactory::Create<MyCopyOnWriteTestStruct>();
+    ENTROPY_VERIFY_NOT_FUNC(original.IsCopyOnWrite());
+
+    // Clones never share the payload
+    Entropy::DataObject clone = original.Clone();
+    ENTROPY_VERIFY_FUNC(clone.IsExactType<MyCopyOnWriteTestStruct>());
+    ENTROPY_VERIFY_FUNC(MyCopyOnWriteTestStruct::copyCount == 1);
+
+    clone.GetData<MyCopyOnWriteTestStruct>().value = 2;
+    ENTROPY_VERIFY_FUNC(original.GetData<MyCopyOnWriteTestStruct>().value == 1);
+    ENTROPY_VERIFY_FUNC(Entropy::DataObject().Clone() == nullptr);
+
+    // Copy-on-write payloads are shared until someone writes
+    ENTROPY_VERIFY_FUNC(original.EnableCopyOnWrite());
+
+    Entropy::DataObject readerA = original;
+    Entropy::DataObject readerB = original;
+    ENTROPY_VERIFY_FUNC(readerA.IsCopyOnWrite());
+
+    const Entropy::DataObject& constReaderA = readerA;
+    ENTROPY_VERIFY_FUNC(&constReaderA.GetData<MyCopyOnWriteTestStruct>() ==
+                        &static_cast<const Entropy::DataObject&>(original).GetData<MyCopyOnWriteTestStruct>());
+    ENTROPY_VERIFY_FUNC(MyCopyOnWriteTestStruct::copyCount == 1);
+
+    readerB.GetData<MyCopyOnWriteTestStruct>().value = 3;
+    ENTROPY_VERIFY_FUNC(MyCopyOnWriteTestStruct::copyCount == 2);
+    ENTROPY_VERIFY_FUNC(readerB.IsCopyOnWrite());
+    ENTROPY_VERIFY_FUNC(readerA.GetData<MyCopyOnWriteTestStruct>().value == 1);
+
+    // The mutable GetData<>() above detached readerA too, which leaves original as the sole owner
+    ENTROPY_VERIFY_FUNC(MyCopyOnWriteTestStruct::copyCount == 3);
+
+    MyCopyOnWriteTestStruct* originalData = &original.GetData<MyCopyOnWriteTestStruct>();
+    originalData->value                   = 4;
+    ENTROPY_VERIFY_FUNC(MyCopyOnWriteTestStruct::copyCount == 3);
+    ENTROPY_VERIFY_FUNC(readerA.GetData<MyCopyOnWriteTestStruct>().value == 1);
+    ENTROPY_VERIFY_FUNC(readerB.GetData<MyCopyOnWriteTestStruct>().value == 3);
+
+    // Detaching inside an arena scope keeps a long-lived payload out of the arena
+    {
+        DataObjectArena arena;
+        Entropy::DataObject longLivedReader = original;
+
+        {
+            DataObjectArena::Scope scope(arena);
+            original.GetData<MyCopyOnWriteTestStruct>().value = 5;
+        }
+        ENTROPY_VERIFY_FUNC(arena.GetObjectCount() == 0);
+
+        arena.Reset();
+        ENTROPY_VERIFY_FUNC(original.GetData<MyCopyOnWriteTestStruct>().value == 5);
+        ENTROPY_VERIFY_FUNC(longLivedReader.GetData<MyCopyOnWriteTestStruct>().value == 4);
+    }
+
+    // Wrapped objects are never owned, so they cannot be copied on write
+    MyCopyOnWriteTestStruct local;
+    Entropy::DataObject wrapped = DataObjectFactory::Wrap(local);
+    ENTROPY_VERIFY_NOT_FUNC(wrapped.EnableCopyOnWrite());
+
+    return 0;
+}
@@ -0,0 +1,152 @@
+// Copyright (c) Entropy Software LLC
+// This file is licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+#include "Entropy/Core/Log.h"
+#include "Entropy/Reflection.h"
+#include "TestMacros.h"
+#include <string>
+#include <vector>
+
+namespace Entropy
+{
+namespace Tests
+{
+namespace DataObject
+{
+
+struct MyArenaTestStruct
+{
+    static int liveCount;
+
+    MyArenaTestStruct() { ++liveCount; }
+    ~MyArenaTestStruct() { --liveCount; }
+
+    std::string name{"arena"};
+    double values[8] = {};
+};
+
+int MyArenaTestStruct::liveCount = 0;
+
+struct MyArenaTestAttribute
+{
+    MyArenaTestAttribute(const char* val)
+        : name(val)
+    {
+    }
+
+    std::string name;
+};
+
+struct MyArenaAttributesTestStruct
+{
+    ENTROPY_REFLECT_CLASS(MyArenaAttributesTestStruct, MyArenaTestAttribute("a name long enough to be heap allocated"))
+
+    ENTROPY_REFLECT_MEMBER(value, MyArenaTestAttribute("member"))
+    int value = 0;
+};
+
+} // namespace DataObject
+} // namespace Tests
+} // namespace Entropy
+
+int DataObject_TestDataObjectArena(int argc, char** const argv)
+{
+    using namespace Entropy;
+    using namespace Entropy::Reflection;
+    using namespace Entropy::Tests::DataObject;
+
+    constexpr int cObjectCount = 1000;
+
+    DataObjectArena arena;
+    ENTROPY_VERIFY_FUNC(DataObjectArena::GetCurrent() == nullptr);
+
+    {
+        DataObjectArena::Scope scope(arena);
+        ENTROPY_VERIFY_FUNC(DataObjectArena::GetCurrent() == &arena);
+
+        std::vector<Entropy::DataObject> objects;
+        for (int i = 0; i < cObjectCount; ++i)
+        {
+            objects.push_back(DataObjectFactory::Create<MyArenaTestStruct>());
+        }
+        objects.push_back(DataObjectFactory::Create<int>(5));
+
+        ENTROPY_VERIFY_FUNC(arena.GetObjectCount() == cObjectCount + 1);
+        ENTROPY_VERIFY_FUNC(objects[0].GetData<MyArenaTestStruct>().name == "arena");
+        ENTROPY_VERIFY_FUNC(objects[cObjectCount].GetData<int>() == 5);
+
+        // Nested scopes restore the previous arena
+        {
+            DataObjectArena innerArena;
+            DataObjectArena::Scope innerScope(innerArena);
+            ENTROPY_VERIFY_FUNC(DataObjectArena::GetCurrent() == &innerArena);
+        }
+        ENTROPY_VERIFY_FUNC(DataObjectArena::GetCurrent() == &arena);
+    }
+
+    // Releasing the objects leaves the destructors to the arena
+    ENTROPY_VERIFY_FUNC(DataObjectArena::GetCurrent() == nullptr);
+    ENTROPY_VERIFY_FUNC(MyArenaTestStruct::liveCount == cObjectCount);
+
+    arena.Reset();
+    ENTROPY_VERIFY_FUNC(MyArenaTestStruct::liveCount == 0);
+    ENTROPY_VERIFY_FUNC(arena.GetObjectCount() == 0);
+
+    // Unique objects give up their arena payload when reset
+    {
+        DataObjectArena::Scope scope(arena);
+
+        UniqueDataObject unique = DataObjectFactory::CreateUnique<MyArenaTestStruct>();
+        ENTROPY_VERIFY_FUNC(unique != nullptr);
+        ENTROPY_VERIFY_FUNC(arena.GetObjectCount() == 1);
+
+        unique.Reset();
+        ENTROPY_VERIFY_FUNC(unique == nullptr);
+    }
+
+    ENTROPY_VERIFY_FUNC(MyArenaTestStruct::liveCount == 1);
+    arena.Reset();
+    ENTROPY_VERIFY_FUNC(MyArenaTestStruct::liveCount == 0);
+    ENTROPY_VERIFY_FUNC(arena.GetObjectCount() == 0);
+
+    // Types reflected for the first time inside a scope keep their data out of the arena
+    {
+        DataObjectArena::Scope scope(arena);
+
+        const Entropy::TypeInfo* typeInfo = ReflectTypeAndGetTypeInfo<MyArenaAttributesTestStruct>();
+        ENTROPY_VERIFY_FUNC(arena.GetObjectCount() == 0);
+
+        // Anything created while a type info is being filled bypasses the arena
+        {
+            Entropy::details::TypeInfoInitializationScope initScope(typeInfo);
+            Entropy::DataObject obj = DataObjectFactory::Create<MyArenaTestStruct>();
+            ENTROPY_VERIFY_FUNC(obj != nullptr);
+            ENTROPY_VERIFY_FUNC(arena.GetObjectCount() == 0);
+        }
+    }
+    arena.Reset();
+    {
+        const ClassDescription* classDesc =
+            ReflectTypeAndGetTypeInfo<MyArenaAttributesTestStruct>()->Get<ClassTypeInfo>().GetClassDescription();
+        ENTROPY_VERIFY_FUNC(classDesc != nullptr);
+
+        const MyArenaTestAttribute* classAttr = classDesc->TryGetAttribute<MyArenaTestAttribute>();
+        ENTROPY_VERIFY_FUNC(classAttr != nullptr && classAttr->name == "a name long enough to be heap allocated");
+
+        const MemberDescription* member = classDesc->FindMember("value");
+        ENTROPY_VERIFY_FUNC(member != nullptr);
+        const MyArenaTestAttribute* memberAttr = member->TryGetAttribute<MyArenaTestAttribute>();
+        ENTROPY_VERIFY_FUNC(memberAttr != nullptr && memberAttr->name == "member");
+    }
+    ENTROPY_VERIFY_FUNC(MyArenaTestStruct::liveCount == 0);
+
+    // Without a scope, objects are allocated as usual
+    {
+        Entropy::DataObject obj = DataObjectFactory::Create<MyArenaTestStruct>();
+        ENTROPY_VERIFY_FUNC(arena.GetObjectCount() == 0);
+    }
+    ENTROPY_VERIFY_FUNC(MyArenaTestStruct::liveCount == 0);
+
+    return 0;
+}
@@ -0,0 +1,117 @@
+// Copyright (c) Entropy Software LLC
+// This file is licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+#include "Entropy/Core/Log.h"
+#include "Entropy/Reflection.h"
+#include "Entropy/Reflection/DataObject/DataObjectContainerPool.h"
+#include "TestMacros.h"
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+int DataObject_TestDataObjectContainerPool(int argc, char** const argv)
+{
+    using namespace Entropy;
+    using Pool = details::DataObjectContainerPool;
+
+    constexpr int cBlockCount = static_cast<int>(Pool::cBatchSize) * 5 + 3;
+
+    std::vector<void*> blocks;
+    for (int i = 0; i < cBlockCount; ++i)
+    {
+        blocks.push_back(Pool::Allocate());
+    }
+
+    bool allAligned = true;
+    for (void* block : blocks)
+    {
+        allAligned &= (block != nullptr) && (reinterpret_cast<std::uintptr_t>(block) % Pool::cBlockAlignment == 0);
+    }
+    ENTROPY_VERIFY_FUNC(allAligned);
+
+    std::vector<void*> sorted = blocks;
+    std::sort(sorted.begin(), sorted.end());
+    ENTROPY_VERIFY_FUNC(std::adjacent_find(sorted.begin(), sorted.end()) == sorted.end());
+
+    // Blocks freed on another thread come back through the shared list once that thread exits
+    std::thread freeThread([&]() {
+        for (void* block : blocks)
+        {
+            Pool::Free(block);
+        }
+    });
+    freeThread.join();
+
+    std::vector<void*> reused;
+    for (int i = 0; i < cBlockCount; ++i)
+    {
+        reused.push_back(Pool::Allocate());
+    }
+
+    int reusedCount = 0;
+    for (void* block : reused)
+    {
+        reusedCount += std::binary_search(sorted.begin(), sorted.end(), block) ? 1 : 0;
+    }
+    ENTROPY_VERIFY_FUNC(reusedCount > 0);
+
+    for (void* block : reused)
+    {
+        Pool::Free(block);
+    }
+
+    // DataObjects keep working on top of the pool, including when released on another thread
+    std::vector<DataObject> objects;
+    for (int i = 0; i < cBlockCount; ++i)
+    {
+        objects.push_back(DataObjectFactory::Create<int>(i));
+    }
+    ENTROPY_VERIFY_FUNC(objects[cBlockCount - 1].GetData<int>() == cBlockCount - 1);
+
+    std::thread releaseThread([&]() { objects.clear(); });
+    releaseThread.join();
+
+    // A consumer thread that only frees, and never fills its cache past the flush threshold, still hands its blocks
+    // back when it exits
+    constexpr int cHandoffCount = static_cast<int>(Pool::cBatchSize) + 1;
+
+    std::vector<void*> handoff;
+    std::thread producerThread([&]() {
+        for (int i = 0; i < cHandoffCount; ++i)
+        {
+            handoff.push_back(Pool::Allocate());
+        }
+    });
+    producerThread.join();
+
+    std::thread consumerThread([&]() {
+        for (void* block : handoff)
+        {
+            Pool::Free(block);
+        }
+    });
+    consumerThread.join();
+
+    std::sort(handoff.begin(), handoff.end());
+
+    int handedBackCount = 0;
+    std::thread reuseThread([&]() {
+        std::vector<void*> taken;
+        for (int i = 0; i < cHandoffCount; ++i)
+        {
+            taken.push_back(Pool::Allocate());
+            handedBackCount += std::binary_search(handoff.begin(), handoff.end(), taken.back()) ? 1 : 0;
+        }
+
+        for (void* block : taken)
+        {
+            Pool::Free(block);
+        }
+    });
+    reuseThread.join();
+    ENTROPY_VERIFY_FUNC(handedBackCount == cHandoffCount);
+
+    return 0;
+}
@@ -0,0 +1,118 @@
+// Copyright (c) Entropy Software LLC
+// This file is licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+#include "Entropy/Core/Log.h"
+#include "Entropy/Reflection.h"
+#include "TestMacros.h"
+#include <cstdint>
+#include <string>
+#include <utility>
+
+namespace Entropy
+{
+namespace Tests
+{
+namespace DataObject
+{
+
+struct MyVectorTestStruct
+{
+    static int liveCount;
+
+    MyVectorTestStruct() { ++liveCount; }
+    MyVectorTestStruct(const MyVectorTestStruct& other)
+        : value(other.value)
+        , name(other.name)
+    {
+        ++liveCount;
+    }
+    MyVectorTestStruct(MyVectorTestStruct&& other)
+        : value(other.value)
+        , name(std::move(other.name))
+    {
+        ++liveCount;
+    }
+    ~MyVectorTestStruct() { --liveCount; }
+
+    int value = 0;
+    std::string name{"element"};
+};
+
+int MyVectorTestStruct::liveCount = 0;
+
+} // namespace DataObject
+} // namespace Tests
+} // namespace Entropy
+
+int DataObject_TestDataObjectVector(int argc, char** const argv)
+{
+    using namespace Entropy;
+    using namespace Entropy::Tests::DataObject;
+
+    constexpr int cCount = 100;
+
+    {
+        DataObjectVector vector(ReflectTypeAndGetTypeInfo<MyVectorTestStruct>());
+        ENTROPY_VERIFY_FUNC(vector.IsEmpty());
+        ENTROPY_VERIFY_FUNC(vector.Reserve(8));
+        ENTROPY_VERIFY_FUNC(vector.GetCapacity() >= 8);
+        const std::size_t reservedCapacity = vector.GetCapacity();
+
+        // Capacities whose byte size does not fit in a size_t are refused instead of wrapping around
+        ENTROPY_VERIFY_NOT_FUNC(vector.Reserve(SIZE_MAX / 2));
+        ENTROPY_VERIFY_FUNC(vector.GetCapacity() == reservedCapacity);
+
+        // Grows past the reserved capacity, relocating the non-trivial elements
+        for (int i = 0; i < cCount; ++i)
+        {
+            ENTROPY_VERIFY_FUNC(vector.Emplace());
+            vector.GetData<MyVectorTestStruct>(i).value = i;
+        }
+        ENTROPY_VERIFY_FUNC(vector.GetSize() == cCount);
+        ENTROPY_VERIFY_FUNC(MyVectorTestStruct::liveCount == cCount);
+        ENTROPY_VERIFY_FUNC(vector.GetData<MyVectorTestStruct>(cCount - 1).value == cCount - 1);
+        ENTROPY_VERIFY_FUNC(vector.GetData<MyVectorTestStruct>(0).name == "element");
+
+        MyVectorTestStruct pushed;
+        pushed.value = 1000;
+        ENTROPY_VERIFY_FUNC(vector.Push(pushed));
+        ENTROPY_VERIFY_FUNC(vector.Push(std::move(pushed)));
+        ENTROPY_VERIFY_NOT_FUNC(vector.Push(5));
+        ENTROPY_VERIFY_FUNC(vector.GetSize() == cCount + 2);
+        ENTROPY_VERIFY_FUNC(vector.GetData<MyVectorTestStruct>(cCount + 1).value == 1000);
+
+        ENTROPY_VERIFY_FUNC(vector.Erase(0));
+        ENTROPY_VERIFY_FUNC(vector.GetData<MyVectorTestStruct>(0).value == 1);
+        ENTROPY_VERIFY_FUNC(vector.GetData<MyVectorTestStruct>(cCount - 2).value == cCount - 1);
+        ENTROPY_VERIFY_NOT_FUNC(vector.Erase(vector.GetSize()));
+
+        vector.PopBack();
+        ENTROPY_VERIFY_FUNC(vector.GetSize() == cCount);
+
+        DataObjectView view = vector[3];
+        ENTROPY_VERIFY_FUNC(view.IsExactType<MyVectorTestStruct>());
+        ENTROPY_VERIFY_FUNC(view.GetData<MyVectorTestStruct>().value == 4);
+
+        DataObjectVector moved(std::move(vector));
+        ENTROPY_VERIFY_FUNC(vector.IsEmpty());
+        ENTROPY_VERIFY_FUNC(moved.GetSize() == cCount);
+
+        moved.Clear();
+        ENTROPY_VERIFY_FUNC(moved.IsEmpty());
+    }
+    ENTROPY_VERIFY_FUNC(MyVectorTestStruct::liveCount == 0);
+
+    // Trivial elements are relocated with memcpy / memmove
+    DataObjectVector ints(ReflectTypeAndGetTypeInfo<int>());
+    for (int i = 0; i < cCount; ++i)
+    {
+        ENTROPY_VERIFY_FUNC(ints.Push(i));
+    }
+
+    ENTROPY_VERIFY_FUNC(ints.Erase(10));
+    ENTROPY_VERIFY_FUNC(ints.GetData<int>(10) == 11);
+    ENTROPY_VERIFY_FUNC(ints.GetData<int>(cCount - 2) == cCount - 1);
+
+    return 0;
+}
@@ -0,0 +1,70 @@
+// Copyright (c) Entropy Software LLC
+// This file is licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+#include "Entropy/Core/Log.h"
+#include "Entropy/Reflection.h"
+#include "TestMacros.h"
+#include <type_traits>
+
+namespace Entropy
+{
+namespace Tests
+{
+namespace DataObject
+{
+
+struct MyViewTestStruct
+{
+    int value = 42;
+};
+
+} // namespace DataObject
+} // namespace Tests
+} // namespace Entropy
+
+int DataObject_TestDataObjectView(int argc, char** const argv)
+{
+    using namespace Entropy;
+    using namespace Entropy::Tests::DataObject;
+
+    ENTROPY_VERIFY_FUNC(std::is_trivially_copyable<DataObjectView>::value);
+
+    DataObjectView nullView;
+    ENTROPY_VERIFY_FUNC(nullView == nullptr);
+    ENTROPY_VERIFY_NOT_FUNC(nullView.IsExactType<int>());
+    ENTROPY_VERIFY_NOT_FUNC(nullView.CanCastTo<int>());
+
+    // Views of existing values refer to them directly
+    MyViewTestStruct value;
+    DataObjectView view = DataObjectFactory::WrapView(value);
+
+    ENTROPY_VERIFY_FUNC(view != nullptr);
+    ENTROPY_VERIFY_FUNC(view.CanCastTo<MyViewTestStruct>());
+    ENTROPY_VERIFY_NOT_FUNC(view.CanCastTo<int>());
+    ENTROPY_VERIFY_FUNC(&view.GetData<MyViewTestStruct>() == &value);
+
+    DataObjectView viewCopy = view;
+    viewCopy.GetData<MyViewTestStruct>().value = 7;
+    ENTROPY_VERIFY_FUNC(value.value == 7);
+
+    // Arrays are stored as a direct pointer
+    int values[3] = {1, 2, 3};
+    DataObjectView arrayView = DataObjectFactory::WrapView(values);
+    ENTROPY_VERIFY_FUNC(arrayView.GetData<int*>()[2] == 3);
+
+    // Views of DataObjects share the payload without taking a reference
+    Entropy::DataObject obj = DataObjectFactory::Create<MyViewTestStruct>();
+    DataObjectView objView  = obj;
+
+    ENTROPY_VERIFY_FUNC(objView.IsExactType<MyViewTestStruct>());
+    ENTROPY_VERIFY_FUNC(objView.GetTypeInfo() == obj.GetTypeInfo());
+    ENTROPY_VERIFY_FUNC(&objView.GetData<MyViewTestStruct>() == &obj.GetData<MyViewTestStruct>());
+    ENTROPY_VERIFY_FUNC(obj.TakeUnique() != nullptr);
+
+    UniqueDataObject unique = DataObjectFactory::CreateUnique<MyViewTestStruct>();
+    DataObjectView uniqueView(unique);
+    ENTROPY_VERIFY_FUNC(uniqueView.GetData<MyViewTestStruct>().value == 42);
+
+    return 0;
+}
@@ -0,0 +1,128 @@
+// Copyright (c) Entropy Software LLC
+// This file is licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+#include "Entropy/Core/Log.h"
+#include "Entropy/Reflection.h"
+#include "TestMacros.h"
+#include <cstdint>
+
+namespace Entropy
+{
+namespace Tests
+{
+namespace DataObject
+{
+
+struct MySmallInlineTestStruct
+{
+    static int liveCount;
+
+    MySmallInlineTestStruct() { ++liveCount; }
+    MySmallInlineTestStruct(const MySmallInlineTestStruct& other) noexcept
+        : value(other.value)
+    {
+        ++liveCount;
+    }
+    ~MySmallInlineTestStruct() { --liveCount; }
+
+    int value = 5;
+};
+
+int MySmallInlineTestStruct::liveCount = 0;
+
+struct MyThrowingMoveInlineTestStruct
+{
+    static int liveCount;
+
+    MyThrowingMoveInlineTestStruct() { ++liveCount; }
+    MyThrowingMoveInlineTestStruct(MyThrowingMoveInlineTestStruct&& other)
+        : value(other.value)
+    {
+        ++liveCount;
+    }
+    ~MyThrowingMoveInlineTestStruct() { --liveCount; }
+
+    int value = 3;
+};
+
+int MyThrowingMoveInlineTestStruct::liveCount = 0;
+
+struct alignas(16) MyLargeInlineTestStruct
+{
+    static int liveCount;
+
+    MyLargeInlineTestStruct() { ++liveCount; }
+    MyLargeInlineTestStruct(const MyLargeInlineTestStruct& other)
+    {
+        ++liveCount;
+        values[15] = other.values[15];
+    }
+    ~MyLargeInlineTestStruct() { --liveCount; }
+
+    double values[16] = {};
+};
+
+int MyLargeInlineTestStruct::liveCount = 0;
+
+} // namespace DataObject
+} // namespace Tests
+} // namespace Entropy
+
+int DataObject_TestInlineStorage(int argc, char** const argv)
+{
+    using namespace Entropy;
+    using namespace Entropy::Tests::DataObject;
+
+    {
+        Entropy::DataObject intObj = DataObjectFactory::Create<int>(42);
+        ENTROPY_VERIFY_FUNC(intObj.IsExactType<int>());
+        ENTROPY_VERIFY_FUNC(intObj.GetData<int>() == 42);
+
+        // Copies still share the same payload
+        Entropy::DataObject intObjCopy = intObj;
+        intObjCopy.GetData<int>()      = 7;
+        ENTROPY_VERIFY_FUNC(intObj.GetData<int>() == 7);
+    }
+
+    {
+        Entropy::DataObject smallObj = DataObjectFactory::Create<MySmallInlineTestStruct>();
+        ENTROPY_VERIFY_FUNC(smallObj.GetData<MySmallInlineTestStruct>().value == 5);
+        ENTROPY_VERIFY_FUNC(MySmallInlineTestStruct::liveCount == 1);
+
+        MySmallInlineTestStruct src;
+        src.value = 9;
+
+        Entropy::DataObject smallCopyObj = DataObjectFactory::Create<MySmallInlineTestStruct>(src);
+        ENTROPY_VERIFY_FUNC(smallCopyObj.GetData<MySmallInlineTestStruct>().value == 9);
+        ENTROPY_VERIFY_FUNC(MySmallInlineTestStruct::liveCount == 3);
+    }
+    ENTROPY_VERIFY_FUNC(MySmallInlineTestStruct::liveCount == 0);
+
+    {
+        // A small type whose move may throw is not stored inline, but behaves the same
+        Entropy::DataObject throwingMoveObj = DataObjectFactory::Create<MyThrowingMoveInlineTestStruct>();
+        ENTROPY_VERIFY_FUNC(throwingMoveObj.GetData<MyThrowingMoveInlineTestStruct>().value == 3);
+        ENTROPY_VERIFY_FUNC(MyThrowingMoveInlineTestStruct::liveCount == 1);
+    }
+    ENTROPY_VERIFY_FUNC(MyThrowingMoveInlineTestStruct::liveCount == 0);
+
+    {
+        // Too big to be stored inline, so it shares an allocation with the container instead
+        Entropy::DataObject largeObj = DataObjectFactory::Create<MyLargeInlineTestStruct>();
+        ENTROPY_VERIFY_FUNC(largeObj.IsExactType<MyLargeInlineTestStruct>());
+        ENTROPY_VERIFY_FUNC(MyLargeInlineTestStruct::liveCount == 1);
+
+        MyLargeInlineTestStruct& largeData = largeObj.GetData<MyLargeInlineTestStruct>();
+        ENTROPY_VERIFY_FUNC(reinterpret_cast<std::uintptr_t>(&largeData) % alignof(MyLargeInlineTestStruct) == 0);
+
+        largeData.values[15] = 3.0;
+
+        Entropy::DataObject largeCopyObj = DataObjectFactory::Create<MyLargeInlineTestStruct>(largeData);
+        ENTROPY_VERIFY_FUNC(largeCopyObj.GetData<MyLargeInlineTestStruct>().values[15] == 3.0);
+        ENTROPY_VERIFY_FUNC(MyLargeInlineTestStruct::liveCount == 2);
+    }
+    ENTROPY_VERIFY_FUNC(MyLargeInlineTestStruct::liveCount == 0);
+
+    return 0;
+}
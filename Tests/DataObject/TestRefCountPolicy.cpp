@@ -0,0 +1,85 @@
+// Copyright (c) Entropy Software LLC
+// This file is licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+#include "Entropy/Core/Log.h"
+#include "Entropy/Reflection.h"
+#include "TestMacros.h"
+#include <string>
+
+namespace Entropy
+{
+namespace Tests
+{
+namespace DataObject
+{
+
+struct MyRefCountPolicyTestStruct
+{
+    static int liveCount;
+
+    MyRefCountPolicyTestStruct() { ++liveCount; }
+    MyRefCountPolicyTestStruct(const MyRefCountPolicyTestStruct& other)
+        : name(other.name)
+    {
+        ++liveCount;
+    }
+    ~MyRefCountPolicyTestStruct() { --liveCount; }
+
+    std::string name{"policy"};
+};
+
+int MyRefCountPolicyTestStruct::liveCount = 0;
+
+} // namespace DataObject
+} // namespace Tests
+} // namespace Entropy
+
+int DataObject_TestRefCountPolicy(int argc, char** const argv)
+{
+    using namespace Entropy;
+    using namespace Entropy::Tests::DataObject;
+
+    {
+        UniqueDataObject unique = DataObjectFactory::CreateUnique<MyRefCountPolicyTestStruct>();
+        ENTROPY_VERIFY_FUNC(unique);
+        ENTROPY_VERIFY_FUNC(unique.IsExactType<MyRefCountPolicyTestStruct>());
+        ENTROPY_VERIFY_FUNC(unique.GetData<MyRefCountPolicyTestStruct>().name == "policy");
+
+        UniqueDataObject movedUnique = std::move(unique);
+        ENTROPY_VERIFY_FUNC(unique == nullptr);
+        ENTROPY_VERIFY_FUNC(MyRefCountPolicyTestStruct::liveCount == 1);
+
+        // Unique -> single threaded shared
+        Entropy::DataObject shared(std::move(movedUnique), DataObjectRefCountPolicy::SingleThreaded);
+        ENTROPY_VERIFY_FUNC(movedUnique == nullptr);
+        ENTROPY_VERIFY_FUNC(shared.GetRefCountPolicy() == DataObjectRefCountPolicy::SingleThreaded);
+
+        {
+            Entropy::DataObject sharedCopy = shared;
+            ENTROPY_VERIFY_FUNC(sharedCopy.GetData<MyRefCountPolicyTestStruct>().name == "policy");
+
+            // More than one owner, so the payload cannot be taken
+            UniqueDataObject failedUnique = shared.TakeUnique();
+            ENTROPY_VERIFY_FUNC(failedUnique == nullptr);
+            ENTROPY_VERIFY_FUNC(shared);
+        }
+
+        // Shared -> unique once we are the only owner
+        UniqueDataObject takenUnique = shared.TakeUnique();
+        ENTROPY_VERIFY_FUNC(takenUnique);
+        ENTROPY_VERIFY_FUNC(shared == nullptr);
+        ENTROPY_VERIFY_FUNC(MyRefCountPolicyTestStruct::liveCount == 1);
+
+        takenUnique.Reset();
+        ENTROPY_VERIFY_FUNC(MyRefCountPolicyTestStruct::liveCount == 0);
+    }
+
+    {
+        Entropy::DataObject atomicShared(DataObjectFactory::CreateUnique<int>(5));
+        ENTROPY_VERIFY_FUNC(atomicShared.GetRefCountPolicy() == DataObjectRefCountPolicy::Atomic);
+        ENTROPY_VERIFY_FUNC(atomicShared.GetData<int>() == 5);
+    }
+
+    return 0;
+}
@@ -0,0 +1,129 @@
+// Copyright (c) Entropy Software LLC
+// This file is licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+#include "Entropy/Core/Log.h"
+#include "Entropy/Reflection.h"
+#include "TestMacros.h"
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace Entropy
+{
+namespace Tests
+{
+namespace TypeInfo
+{
+
+template <int TIndex>
+struct MyIndexedTestAttribute
+{
+    MyIndexedTestAttribute(int val)
+        : value(val)
+    {
+    }
+
+    int value = 0;
+};
+
+struct MyNameTestAttribute
+{
+    MyNameTestAttribute(const char* val)
+        : name(val)
+    {
+    }
+
+    std::string name;
+};
+
+struct MyAttributesTestStruct
+{
+    ENTROPY_REFLECT_CLASS(MyAttributesTestStruct, MyIndexedTestAttribute<0>(100), MyNameTestAttribute("class"))
+
+    ENTROPY_REFLECT_MEMBER(plain)
+    int plain = 0;
+
+    ENTROPY_REFLECT_MEMBER(named, MyNameTestAttribute("a name long enough to not fit in any small string buffer"))
+    int named = 0;
+
+    // More attributes than are searched linearly
+    ENTROPY_REFLECT_MEMBER(many, MyIndexedTestAttribute<0>(0), MyIndexedTestAttribute<1>(1),
+                           MyIndexedTestAttribute<2>(2), MyIndexedTestAttribute<3>(3), MyIndexedTestAttribute<4>(4),
+                           MyIndexedTestAttribute<5>(5), MyIndexedTestAttribute<6>(6), MyIndexedTestAttribute<7>(7),
+                           MyIndexedTestAttribute<8>(8), MyIndexedTestAttribute<9>(9))
+    int many = 0;
+};
+
+template <int TIndex>
+bool CheckIndexedAttribute(const Entropy::Reflection::AttributeContainer& container)
+{
+    const MyIndexedTestAttribute<TIndex>* attr = container.TryGetAttribute<MyIndexedTestAttribute<TIndex>>();
+    return (attr != nullptr) && (attr->value == TIndex);
+}
+
+} // namespace TypeInfo
+} // namespace Tests
+} // namespace Entropy
+
+int TypeInfo_TestAttributes(int argc, char** const argv)
+{
+    using namespace Entropy;
+    using namespace Entropy::Reflection;
+    using namespace Entropy::Tests::TypeInfo;
+
+    const ClassDescription* classDesc =
+        ReflectTypeAndGetTypeInfo<MyAttributesTestStruct>()->Get<ClassTypeInfo>().GetClassDescription();
+    ENTROPY_VERIFY_FUNC(classDesc != nullptr);
+
+    // Class attributes
+    ENTROPY_VERIFY_FUNC(classDesc->GetAllAttributes().size() == 2);
+    ENTROPY_VERIFY_FUNC(classDesc->TryGetAttribute<MyIndexedTestAttribute<0>>()->value == 100);
+    ENTROPY_VERIFY_FUNC(classDesc->TryGetAttribute<MyNameTestAttribute>()->name == "class");
+    ENTROPY_VERIFY_FUNC(classDesc->TryGetAttribute<MyIndexedTestAttribute<1>>() == nullptr);
+
+    // Member attributes
+    const MemberDescription* plainMember = classDesc->FindMember("plain");
+    ENTROPY_VERIFY_FUNC(plainMember->GetAllAttributes().empty());
+    ENTROPY_VERIFY_FUNC(plainMember->TryGetAttribute<MyNameTestAttribute>() == nullptr);
+
+    const MemberDescription* namedMember = classDesc->FindMember("named");
+    ENTROPY_VERIFY_FUNC(namedMember->TryGetAttribute<MyNameTestAttribute>()->name ==
+                        "a name long enough to not fit in any small string buffer");
+
+    const AttributeData* nameData = namedMember->FindAttribute(Traits::TypeIdOf<MyNameTestAttribute>{}());
+    ENTROPY_VERIFY_FUNC(nameData != nullptr);
+    ENTROPY_VERIFY_FUNC(nameData->GetTypeInfo() == ReflectTypeAndGetTypeInfo<MyNameTestAttribute>());
+    ENTROPY_VERIFY_FUNC(nameData->IsType<MyNameTestAttribute>());
+    ENTROPY_VERIFY_FUNC(nameData->TryGetData<MyIndexedTestAttribute<0>>() == nullptr);
+
+    // Large attribute sets are kept sorted and binary searched
+    const MemberDescription* manyMember = classDesc->FindMember("many");
+    const AttributeRange manyAttrs      = manyMember->GetAllAttributes();
+    ENTROPY_VERIFY_FUNC(manyAttrs.size() == 10);
+    for (std::size_t i = 1; i < manyAttrs.size(); ++i)
+    {
+        ENTROPY_VERIFY_FUNC(std::less<TypeId>{}(manyAttrs[i - 1].GetTypeId(), manyAttrs[i].GetTypeId()));
+    }
+
+    ENTROPY_VERIFY_FUNC(CheckIndexedAttribute<0>(*manyMember));
+    ENTROPY_VERIFY_FUNC(CheckIndexedAttribute<3>(*manyMember));
+    ENTROPY_VERIFY_FUNC(CheckIndexedAttribute<9>(*manyMember));
+    ENTROPY_VERIFY_FUNC(manyMember->TryGetAttribute<MyNameTestAttribute>() == nullptr);
+    ENTROPY_VERIFY_FUNC(manyMember->TryGetAttribute<MyIndexedTestAttribute<10>>() == nullptr);
+
+    // Every owner's run is a slice of the class's shared attribute list
+    const AttributeRange classAttrs = classDesc->GetAllAttributes();
+    const AttributeRange namedAttrs = namedMember->GetAllAttributes();
+    ENTROPY_VERIFY_FUNC(namedAttrs.begin() == classAttrs.end());
+    ENTROPY_VERIFY_FUNC(manyAttrs.begin() == namedAttrs.end());
+
+    // Values are placed in the class's shared storage with their natural alignment
+    for (const AttributeData& data : manyAttrs)
+    {
+        const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(data.GetData<MyIndexedTestAttribute<0>>());
+        ENTROPY_VERIFY_FUNC(address % alignof(MyIndexedTestAttribute<0>) == 0);
+    }
+
+    return 0;
+}
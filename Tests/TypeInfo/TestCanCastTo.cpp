@@ -99,6 +99,26 @@ int TypeInfo_TestCanCastTo(int argc, char** const argv)
     ENTROPY_VERIFY_FUNC(CheckCanCastTo<MyCastTestStruct[4], MyCastTestStruct[4]>());
     ENTROPY_VERIFY_FUNC(CheckCanCastTo<const MyCastTestStruct[4], const MyCastTestStruct[4]>());
     ENTROPY_VERIFY_NOT_FUNC(CheckCanCastTo<MyCastTestStruct[4], const MyCastTestStruct[4]>());
+    ENTROPY_VERIFY_FUNC(CheckCanCastTo<MyCastTestStruct(**)[4], MyCastTestStruct(** const)[4]>());
+    ENTROPY_VERIFY_NOT_FUNC(CheckCanCastTo<MyCastTestStruct(**)[4], MyCastTestStruct(**)[3]>());
+    ENTROPY_VERIFY_FUNC(CheckCanCastTo<MyCastTestStruct(&)[4], MyCastTestStruct[4]>());
+
+    // The fully unqualified type is recorded once, no matter how deep the qualifiers go
+    const Entropy::TypeInfo* baseTypeInfo = Entropy::ReflectTypeAndGetTypeInfo<MyCastTestStruct>();
+    ENTROPY_VERIFY_FUNC(baseTypeInfo->GetFullyUnqualifiedType() == baseTypeInfo);
+    ENTROPY_VERIFY_FUNC(Entropy::ReflectTypeAndGetTypeInfo<const MyCastTestStruct* const* [4]>()
+                            ->GetFullyUnqualifiedType() == baseTypeInfo);
+
+    // Results are cached per type info. Repeated checks, including ones that evict each other, must keep agreeing.
+    for (int i = 0; i < 3; ++i)
+    {
+        ENTROPY_VERIFY_FUNC(CheckCanCastTo<int**&, const int**>());
+        ENTROPY_VERIFY_NOT_FUNC(CheckCanCastTo<int**&, int*>());
+        ENTROPY_VERIFY_NOT_FUNC(CheckCanCastTo<int**&, float**>());
+        ENTROPY_VERIFY_FUNC(CheckCanCastTo<int**&, int**>());
+        ENTROPY_VERIFY_NOT_FUNC(CheckCanCastTo<int**&, char**>());
+        ENTROPY_VERIFY_FUNC(CheckCanCastTo<int**&, int** const>());
+    }
 
     return 0;
 }
@@ -0,0 +1,263 @@
+// Copyright (c) Entropy Software LLC
+// This file is licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+#include "Entropy/Core/Log.h"
+#include "Entropy/Reflection.h"
+#include "TestMacros.h"
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+namespace Entropy
+{
+namespace Tests
+{
+namespace TypeInfo
+{
+
+struct MyClassMembersTestStruct
+{
+    ENTROPY_REFLECT_CLASS(MyClassMembersTestStruct)
+
+    ENTROPY_REFLECT_MEMBER(zeta)
+    int zeta = 0;
+
+    ENTROPY_REFLECT_MEMBER(alpha)
+    float alpha = 0.0f;
+
+    ENTROPY_REFLECT_MEMBER(mid)
+    double mid = 0.0;
+
+    ENTROPY_REFLECT_MEMBER(a0)
+    int a0 = 0;
+
+    ENTROPY_REFLECT_MEMBER(a1)
+    int a1 = 0;
+
+    ENTROPY_REFLECT_MEMBER(a2)
+    int a2 = 0;
+
+    ENTROPY_REFLECT_MEMBER(a3)
+    int a3 = 0;
+
+    ENTROPY_REFLECT_MEMBER(a4)
+    int a4 = 0;
+
+    ENTROPY_REFLECT_MEMBER(a5)
+    int a5 = 0;
+};
+
+struct MyNonStandardLayoutMembersTestStruct
+{
+    ENTROPY_REFLECT_CLASS(MyNonStandardLayoutMembersTestStruct)
+
+    virtual ~MyNonStandardLayoutMembersTestStruct() {}
+
+    ENTROPY_REFLECT_MEMBER(value)
+    double value = 0.0;
+
+    ENTROPY_REFLECT_MEMBER(name)
+    std::string name;
+
+    ENTROPY_REFLECT_MEMBER(id)
+    const int id = 7;
+};
+
+struct MyFlattenBaseTestStruct
+{
+    ENTROPY_REFLECT_CLASS(MyFlattenBaseTestStruct)
+
+    ENTROPY_REFLECT_MEMBER(x)
+    int x = 0;
+
+    ENTROPY_REFLECT_MEMBER(y)
+    float y = 0.0f;
+};
+
+// Standard layout, so inherited members keep their offsets
+struct MyFlattenStandardLayoutTestStruct : public MyFlattenBaseTestStruct
+{
+    ENTROPY_REFLECT_CLASS_WITH_BASE(MyFlattenStandardLayoutTestStruct, MyFlattenBaseTestStruct)
+};
+
+// Adding a vtable moves the base class away from the start of the object
+struct MyFlattenVirtualTestStruct : public MyFlattenBaseTestStruct
+{
+    ENTROPY_REFLECT_CLASS_WITH_BASE(MyFlattenVirtualTestStruct, MyFlattenBaseTestStruct)
+
+    virtual ~MyFlattenVirtualTestStruct() {}
+
+    ENTROPY_REFLECT_MEMBER(z)
+    double z = 0.0;
+};
+
+struct MyFlattenLeafTestStruct : public MyFlattenVirtualTestStruct
+{
+    ENTROPY_REFLECT_CLASS_WITH_BASE(MyFlattenLeafTestStruct, MyFlattenVirtualTestStruct)
+
+    ENTROPY_REFLECT_MEMBER(x)
+    int x = 0;
+};
+
+} // namespace TypeInfo
+} // namespace Tests
+} // namespace Entropy
+
+int TypeInfo_TestClassMembers(int argc, char** const argv)
+{
+    using namespace Entropy;
+    using namespace Entropy::Reflection;
+    using namespace Entropy::Tests::TypeInfo;
+
+    const Entropy::TypeInfo* typeInfo = ReflectTypeAndGetTypeInfo<MyClassMembersTestStruct>();
+    const ClassDescription* classDesc = typeInfo->Get<ClassTypeInfo>().GetClassDescription();
+    ENTROPY_VERIFY_FUNC(classDesc != nullptr);
+
+    // Members keep their declaration order
+    const char* const expectedNames[] = {"zeta", "alpha", "mid", "a0", "a1", "a2", "a3", "a4", "a5"};
+
+    int index = 0;
+    for (const MemberDescription& member : classDesc->GetMembers())
+    {
+        ENTROPY_VERIFY_FUNC(index < 9);
+        ENTROPY_VERIFY_FUNC(std::strcmp(member.GetMemberName(), expectedNames[index]) == 0);
+        ++index;
+    }
+    ENTROPY_VERIFY_FUNC(index == 9);
+
+    // Lookups by runtime strings, including ones that are not the string literal the member was registered with
+    for (const char* name : expectedNames)
+    {
+        const std::string runtimeName(name);
+
+        const MemberDescription* member = classDesc->FindMember(runtimeName.c_str());
+        ENTROPY_VERIFY_FUNC(member != nullptr);
+        ENTROPY_VERIFY_FUNC(std::strcmp(member->GetMemberName(), name) == 0);
+    }
+
+    ENTROPY_VERIFY_FUNC(classDesc->FindMember("mid")->GetMemberType() == ReflectTypeAndGetTypeInfo<double>());
+    ENTROPY_VERIFY_FUNC(classDesc->FindMember("alpha", 5)->GetMemberType() == ReflectTypeAndGetTypeInfo<float>());
+
+    ENTROPY_VERIFY_FUNC(classDesc->FindMember("") == nullptr);
+    ENTROPY_VERIFY_FUNC(classDesc->FindMember("a") == nullptr);
+    ENTROPY_VERIFY_FUNC(classDesc->FindMember("a55") == nullptr);
+    ENTROPY_VERIFY_FUNC(classDesc->FindMember("alpha", 4) == nullptr);
+
+    // Standard layout classes know where each member lives
+    const MemberDescription* midMember = classDesc->FindMember("mid");
+    ENTROPY_VERIFY_FUNC(midMember->HasOffset());
+    ENTROPY_VERIFY_FUNC(midMember->GetOffset() == static_cast<int>(offsetof(MyClassMembersTestStruct, mid)));
+    ENTROPY_VERIFY_FUNC(midMember->GetSize() == sizeof(double));
+    ENTROPY_VERIFY_FUNC(midMember->GetAlignment() == alignof(double));
+    ENTROPY_VERIFY_FUNC(classDesc->FindMember("a5")->GetOffset() ==
+                        static_cast<int>(offsetof(MyClassMembersTestStruct, a5)));
+
+    MyClassMembersTestStruct obj;
+    obj.mid = 2.5;
+    ENTROPY_VERIFY_FUNC(*reinterpret_cast<const double*>(reinterpret_cast<const char*>(&obj) +
+                                                          midMember->GetOffset()) == 2.5);
+
+    // Everything else still has a size, but no offset
+    const ClassDescription* nonStandardDesc =
+        ReflectTypeAndGetTypeInfo<MyNonStandardLayoutMembersTestStruct>()->Get<ClassTypeInfo>().GetClassDescription();
+    ENTROPY_VERIFY_FUNC(nonStandardDesc != nullptr);
+
+    const MemberDescription* valueMember = nonStandardDesc->FindMember("value");
+    ENTROPY_VERIFY_FUNC(valueMember != nullptr);
+    ENTROPY_VERIFY_NOT_FUNC(valueMember->HasOffset());
+    ENTROPY_VERIFY_FUNC(valueMember->GetOffset() == -1);
+    ENTROPY_VERIFY_FUNC(valueMember->GetSize() == sizeof(double));
+
+    // Members can be read and written through the description alone, with or without an offset
+    MyNonStandardLayoutMembersTestStruct nonStandardObj;
+    void* nonStandardPtr = &nonStandardObj;
+
+    ENTROPY_VERIFY_FUNC(valueMember->GetMemberPtr(nonStandardPtr) == &nonStandardObj.value);
+    ENTROPY_VERIFY_FUNC(midMember->GetMemberPtr(static_cast<void*>(&obj)) == &obj.mid);
+
+    ENTROPY_VERIFY_FUNC(valueMember->Set(nonStandardPtr, 4.0));
+    ENTROPY_VERIFY_FUNC(nonStandardObj.value == 4.0);
+    ENTROPY_VERIFY_FUNC(*valueMember->Get<double>(nonStandardPtr) == 4.0);
+
+    const MemberDescription* nameMember = nonStandardDesc->FindMember("name");
+    ENTROPY_VERIFY_FUNC(nameMember->Set(nonStandardPtr, std::string("moved in")));
+    ENTROPY_VERIFY_FUNC(nonStandardObj.name == "moved in");
+
+    const std::string copiedName("copied in");
+    ENTROPY_VERIFY_FUNC(nameMember->Set(nonStandardPtr, copiedName));
+    ENTROPY_VERIFY_FUNC(*nameMember->Get<std::string>(static_cast<const void*>(&nonStandardObj)) == "copied in");
+
+    // Type mismatches and const members are refused instead of corrupting the object
+    ENTROPY_VERIFY_FUNC(valueMember->Get<float>(nonStandardPtr) == nullptr);
+    ENTROPY_VERIFY_NOT_FUNC(valueMember->Set(nonStandardPtr, 1));
+
+    const MemberDescription* idMember = nonStandardDesc->FindMember("id");
+    ENTROPY_VERIFY_FUNC(idMember->Get<int>(nonStandardPtr) == nullptr);
+    ENTROPY_VERIFY_FUNC(*idMember->Get<const int>(nonStandardPtr) == 7);
+    ENTROPY_VERIFY_FUNC(*idMember->Get<int>(static_cast<const void*>(&nonStandardObj)) == 7);
+    ENTROPY_VERIFY_NOT_FUNC(idMember->Set(nonStandardPtr, 8));
+    ENTROPY_VERIFY_FUNC(nonStandardObj.id == 7);
+
+    // The flattened list of a class without a base class is its own members
+    ENTROPY_VERIFY_FUNC(VectorOps::GetCount(classDesc->GetAllMembers()) == 9);
+
+    const FlattenedMember& flattenedMid = VectorOps::At(classDesc->GetAllMembers(), 2);
+    ENTROPY_VERIFY_FUNC(flattenedMid.GetMemberPtr(static_cast<void*>(&obj)) == &obj.mid);
+
+    // Inherited members of a standard layout class are plain offsets from the derived class
+    const ClassDescription* standardLayoutDesc =
+        ReflectTypeAndGetTypeInfo<MyFlattenStandardLayoutTestStruct>()->Get<ClassTypeInfo>().GetClassDescription();
+    ENTROPY_VERIFY_FUNC(standardLayoutDesc != nullptr);
+    ENTROPY_VERIFY_FUNC(VectorOps::GetCount(standardLayoutDesc->GetAllMembers()) == 2);
+
+    const FlattenedMember& inheritedY = VectorOps::At(standardLayoutDesc->GetAllMembers(), 1);
+    ENTROPY_VERIFY_FUNC(std::strcmp(inheritedY.GetMemberName(), "y") == 0);
+    ENTROPY_VERIFY_FUNC(inheritedY.GetDeclaringClass() == ReflectTypeAndGetTypeInfo<MyFlattenBaseTestStruct>());
+    ENTROPY_VERIFY_FUNC(inheritedY.HasOffset());
+
+    MyFlattenStandardLayoutTestStruct standardLayoutObj;
+    ENTROPY_VERIFY_FUNC(inheritedY.Set(static_cast<void*>(&standardLayoutObj), 1.5f));
+    ENTROPY_VERIFY_FUNC(standardLayoutObj.y == 1.5f);
+
+    // Deeper hierarchies list the root's members first, and reach them through the declaring class when needed
+    const ClassDescription* leafDesc =
+        ReflectTypeAndGetTypeInfo<MyFlattenLeafTestStruct>()->Get<ClassTypeInfo>().GetClassDescription();
+    ENTROPY_VERIFY_FUNC(leafDesc != nullptr);
+
+    const char* const expectedLeafNames[] = {"x", "y", "z", "x"};
+
+    MyFlattenLeafTestStruct leafObj;
+    leafObj.MyFlattenBaseTestStruct::x = 1;
+    leafObj.y                          = 2.0f;
+    leafObj.z                          = 3.0;
+    leafObj.x                          = 4;
+
+    void* const leafMemberPtrs[] = {&leafObj.MyFlattenBaseTestStruct::x, &leafObj.y, &leafObj.z, &leafObj.x};
+
+    index = 0;
+    for (const FlattenedMember& member : leafDesc->GetAllMembers())
+    {
+        ENTROPY_VERIFY_FUNC(index < 4);
+        ENTROPY_VERIFY_FUNC(std::strcmp(member.GetMemberName(), expectedLeafNames[index]) == 0);
+        ENTROPY_VERIFY_NOT_FUNC(member.HasOffset());
+        ENTROPY_VERIFY_FUNC(member.GetMemberPtr(static_cast<void*>(&leafObj)) == leafMemberPtrs[index]);
+        ++index;
+    }
+    ENTROPY_VERIFY_FUNC(index == 4);
+
+    const FlattenedMember& inheritedX = VectorOps::At(leafDesc->GetAllMembers(), 0);
+    ENTROPY_VERIFY_FUNC(*inheritedX.Get<int>(static_cast<const void*>(&leafObj)) == 1);
+    ENTROPY_VERIFY_FUNC(inheritedX.GetMemberDescription() ==
+                        ReflectTypeAndGetTypeInfo<MyFlattenBaseTestStruct>()
+                            ->Get<ClassTypeInfo>()
+                            .GetClassDescription()
+                            ->FindMember("x"));
+    ENTROPY_VERIFY_FUNC(VectorOps::At(leafDesc->GetAllMembers(), 3).GetMemberDescription() ==
+                        leafDesc->FindMember("x"));
+
+    // Own members are unaffected
+    ENTROPY_VERIFY_FUNC(VectorOps::GetCount(leafDesc->GetMembers()) == 1);
+
+    return 0;
+}
@@ -0,0 +1,152 @@
+// Copyright (c) Entropy Software LLC
+// This file is licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+#include "Entropy/Core/Log.h"
+#include "Entropy/Reflection.h"
+#include "TestMacros.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace Entropy
+{
+namespace Tests
+{
+namespace TypeInfo
+{
+
+struct MyConcurrentMemberStruct
+{
+    ENTROPY_REFLECT_CLASS(MyConcurrentMemberStruct)
+
+    ENTROPY_REFLECT_MEMBER(value)
+    int value = 0;
+};
+
+struct MyConcurrentReflectionStruct
+{
+    ENTROPY_REFLECT_CLASS(MyConcurrentReflectionStruct)
+
+    ENTROPY_REFLECT_MEMBER(a)
+    MyConcurrentMemberStruct a{};
+
+    ENTROPY_REFLECT_MEMBER(b)
+    float b = 0.0f;
+};
+
+struct MyConcurrentCycleStructB;
+
+// Filling either of these reflects the other, so threads that start from different ends wait on each other
+struct MyConcurrentCycleStructA
+{
+    ENTROPY_REFLECT_CLASS(MyConcurrentCycleStructA)
+
+    ENTROPY_REFLECT_MEMBER(other)
+    MyConcurrentCycleStructB* other = nullptr;
+};
+
+struct MyConcurrentCycleStructB
+{
+    ENTROPY_REFLECT_CLASS(MyConcurrentCycleStructB)
+
+    ENTROPY_REFLECT_MEMBER(other)
+    MyConcurrentCycleStructA* other = nullptr;
+};
+
+} // namespace TypeInfo
+} // namespace Tests
+} // namespace Entropy
+
+int TypeInfo_TestConcurrentReflection(int argc, char** const argv)
+{
+    using namespace Entropy;
+    using namespace Entropy::Reflection;
+    using namespace Entropy::Tests::TypeInfo;
+
+    constexpr int cThreadCount = 8;
+
+    std::atomic_bool start{false};
+    std::atomic_int fullyInitializedCount{0};
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < cThreadCount; ++t)
+    {
+        threads.emplace_back([&]() {
+            while (!start.load())
+            {
+                std::this_thread::yield();
+            }
+
+            // Every thread races to be first. Whoever loses must still get back a fully filled type info.
+            const Entropy::TypeInfo* typeInfo = ReflectTypeAndGetTypeInfo<MyConcurrentReflectionStruct>();
+
+            const ClassDescription* classDesc = typeInfo->Get<ClassTypeInfo>().GetClassDescription();
+            if (!classDesc || !typeInfo->CanConstruct())
+            {
+                return;
+            }
+
+            int memberCount = 0;
+            for (const MemberDescription& member : classDesc->GetMembers())
+            {
+                ++memberCount;
+            }
+
+            if (memberCount == 2)
+            {
+                ++fullyInitializedCount;
+            }
+        });
+    }
+
+    start.store(true);
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    ENTROPY_VERIFY_FUNC(fullyInitializedCount.load() == cThreadCount);
+
+    // Types that refer to each other must not deadlock when different threads start filling each of them
+    start.store(false);
+    threads.clear();
+
+    for (int t = 0; t < cThreadCount; ++t)
+    {
+        threads.emplace_back([&, t]() {
+            while (!start.load())
+            {
+                std::this_thread::yield();
+            }
+
+            if (t % 2 == 0)
+            {
+                ReflectTypeAndGetTypeInfo<MyConcurrentCycleStructA>();
+            }
+            else
+            {
+                ReflectTypeAndGetTypeInfo<MyConcurrentCycleStructB>();
+            }
+        });
+    }
+
+    start.store(true);
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    ENTROPY_VERIFY_FUNC(VectorOps::GetCount(ReflectTypeAndGetTypeInfo<MyConcurrentCycleStructA>()
+                                                ->Get<ClassTypeInfo>()
+                                                .GetClassDescription()
+                                                ->GetMembers()) == 1);
+    ENTROPY_VERIFY_FUNC(VectorOps::GetCount(ReflectTypeAndGetTypeInfo<MyConcurrentCycleStructB>()
+                                                ->Get<ClassTypeInfo>()
+                                                .GetClassDescription()
+                                                ->GetMembers()) == 1);
+
+    return 0;
+}
@@ -0,0 +1,147 @@
+// Copyright (c) Entropy Software LLC
+// This file is licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+#include "Entropy/Core/Log.h"
+#include "Entropy/Reflection.h"
+#include "TestMacros.h"
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+namespace Entropy
+{
+namespace Tests
+{
+namespace TypeInfo
+{
+
+struct alignas(16) MyConstructAtTestStruct
+{
+    static int liveCount;
+
+    MyConstructAtTestStruct() { ++liveCount; }
+    MyConstructAtTestStruct(const MyConstructAtTestStruct& other)
+        : value(other.value)
+        , name(other.name)
+    {
+        ++liveCount;
+    }
+    MyConstructAtTestStruct(MyConstructAtTestStruct&& other)
+        : value(other.value)
+        , name(std::move(other.name))
+    {
+        ++liveCount;
+    }
+    ~MyConstructAtTestStruct() { --liveCount; }
+
+    int value = 42;
+    std::string name{"constructed"};
+};
+
+int MyConstructAtTestStruct::liveCount = 0;
+
+struct MyTrivialConstructAtTestStruct
+{
+    int a;
+    float b;
+};
+
+struct MyNoDefaultConstructAtTestStruct
+{
+    MyNoDefaultConstructAtTestStruct(int) {}
+};
+
+} // namespace TypeInfo
+} // namespace Tests
+} // namespace Entropy
+
+int TypeInfo_TestConstructAt(int argc, char** const argv)
+{
+    using namespace Entropy;
+    using namespace Entropy::Tests::TypeInfo;
+
+    const Entropy::TypeInfo* typeInfo = ReflectTypeAndGetTypeInfo<MyConstructAtTestStruct>();
+
+    ENTROPY_VERIFY_FUNC(typeInfo->GetSize() == sizeof(MyConstructAtTestStruct));
+    ENTROPY_VERIFY_FUNC(typeInfo->GetAlignment() == alignof(MyConstructAtTestStruct));
+
+    ENTROPY_VERIFY_FUNC(ReflectTypeAndGetTypeInfo<int>()->GetSize() == sizeof(int));
+    ENTROPY_VERIFY_FUNC(ReflectTypeAndGetTypeInfo<int&>()->GetSize() == 0);
+    ENTROPY_VERIFY_FUNC(ReflectTypeAndGetTypeInfo<const float[3]>()->GetSize() == sizeof(float[3]));
+
+    typename std::aligned_storage<sizeof(MyConstructAtTestStruct), alignof(MyConstructAtTestStruct)>::type storage[3];
+
+    ENTROPY_VERIFY_FUNC(typeInfo->ConstructAt(&storage[0]));
+    ENTROPY_VERIFY_FUNC(reinterpret_cast<MyConstructAtTestStruct*>(&storage[0])->value == 42);
+
+    reinterpret_cast<MyConstructAtTestStruct*>(&storage[0])->value = 7;
+
+    ENTROPY_VERIFY_FUNC(typeInfo->CopyConstructAt(&storage[1], &storage[0]));
+    ENTROPY_VERIFY_FUNC(reinterpret_cast<MyConstructAtTestStruct*>(&storage[1])->value == 7);
+
+    ENTROPY_VERIFY_FUNC(typeInfo->MoveConstructAt(&storage[2], &storage[1]));
+    ENTROPY_VERIFY_FUNC(reinterpret_cast<MyConstructAtTestStruct*>(&storage[2])->name == "constructed");
+    ENTROPY_VERIFY_FUNC(MyConstructAtTestStruct::liveCount == 3);
+
+    typeInfo->DestructAt(&storage[0]);
+    typeInfo->DestructAt(&storage[1]);
+    typeInfo->DestructAt(&storage[2]);
+    ENTROPY_VERIFY_FUNC(MyConstructAtTestStruct::liveCount == 0);
+
+    // Bulk variants of the same operations
+    constexpr int cCount = 8;
+    typename std::aligned_storage<sizeof(MyConstructAtTestStruct), alignof(MyConstructAtTestStruct)>::type
+        srcStorage[cCount];
+    typename std::aligned_storage<sizeof(MyConstructAtTestStruct), alignof(MyConstructAtTestStruct)>::type
+        dstStorage[cCount];
+
+    MyConstructAtTestStruct* srcElements = reinterpret_cast<MyConstructAtTestStruct*>(srcStorage);
+    MyConstructAtTestStruct* dstElements = reinterpret_cast<MyConstructAtTestStruct*>(dstStorage);
+
+    ENTROPY_VERIFY_FUNC(typeInfo->ConstructN(srcStorage, cCount));
+    ENTROPY_VERIFY_FUNC(MyConstructAtTestStruct::liveCount == cCount);
+    srcElements[cCount - 1].value = 11;
+
+    ENTROPY_VERIFY_FUNC(typeInfo->CopyConstructN(dstStorage, srcStorage, cCount));
+    ENTROPY_VERIFY_FUNC(dstElements[cCount - 1].value == 11);
+    ENTROPY_VERIFY_FUNC(MyConstructAtTestStruct::liveCount == 2 * cCount);
+
+    typeInfo->DestructN(dstStorage, cCount);
+
+    ENTROPY_VERIFY_FUNC(typeInfo->MoveConstructN(dstStorage, srcStorage, cCount));
+    ENTROPY_VERIFY_FUNC(dstElements[0].name == "constructed");
+    ENTROPY_VERIFY_FUNC(dstElements[cCount - 1].value == 11);
+
+    typeInfo->DestructN(srcStorage, cCount);
+    typeInfo->DestructN(dstStorage, cCount);
+    ENTROPY_VERIFY_FUNC(MyConstructAtTestStruct::liveCount == 0);
+
+    // Trivial types go through memset / memcpy
+    const Entropy::TypeInfo* trivialTypeInfo = ReflectTypeAndGetTypeInfo<MyTrivialConstructAtTestStruct>();
+
+    MyTrivialConstructAtTestStruct trivialSrc[cCount];
+    MyTrivialConstructAtTestStruct trivialDst[cCount];
+    std::memset(trivialSrc, 0xFF, sizeof(trivialSrc));
+
+    ENTROPY_VERIFY_FUNC(trivialTypeInfo->ConstructN(trivialSrc, cCount));
+    ENTROPY_VERIFY_FUNC(trivialSrc[cCount - 1].a == 0 && trivialSrc[cCount - 1].b == 0.0f);
+
+    trivialSrc[3].a = 3;
+    ENTROPY_VERIFY_FUNC(trivialTypeInfo->CopyConstructN(trivialDst, trivialSrc, cCount));
+    ENTROPY_VERIFY_FUNC(trivialDst[3].a == 3);
+
+    trivialSrc[4].a = 4;
+    ENTROPY_VERIFY_FUNC(trivialTypeInfo->MoveConstructN(trivialDst, trivialSrc, cCount));
+    ENTROPY_VERIFY_FUNC(trivialDst[4].a == 4);
+
+    trivialTypeInfo->DestructN(trivialDst, cCount);
+
+    // Missing constructors are reported instead of silently doing nothing
+    const Entropy::TypeInfo* noDefaultTypeInfo = ReflectTypeAndGetTypeInfo<MyNoDefaultConstructAtTestStruct>();
+
+    typename std::aligned_storage<sizeof(MyNoDefaultConstructAtTestStruct)>::type noDefaultStorage;
+    ENTROPY_VERIFY_NOT_FUNC(noDefaultTypeInfo->ConstructAt(&noDefaultStorage));
+
+    return 0;
+}
@@ -0,0 +1,58 @@
+// Copyright (c) Entropy Software LLC
+// This file is licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+#include "Entropy/Core/Log.h"
+#include "Entropy/Reflection.h"
+#include "TestMacros.h"
+
+namespace Entropy
+{
+namespace Tests
+{
+namespace TypeInfo
+{
+
+struct MyOnLoadTestStruct
+{
+    ENTROPY_REFLECT_CLASS(MyOnLoadTestStruct)
+
+    ENTROPY_REFLECT_MEMBER(value)
+    int value = 0;
+};
+
+struct MyOtherOnLoadTestStruct
+{
+    ENTROPY_REFLECT_CLASS(MyOtherOnLoadTestStruct)
+};
+
+} // namespace TypeInfo
+} // namespace Tests
+} // namespace Entropy
+
+int TypeInfo_TestReflectOnLoad(int argc, char** const argv)
+{
+    using namespace Entropy;
+    using namespace Entropy::Tests::TypeInfo;
+
+    bool foundOnLoadStruct      = false;
+    bool foundOtherOnLoadStruct = false;
+    bool allTimed               = true;
+
+    std::size_t count =
+        InitializeAllReflectedTypes(2, [&](const Entropy::TypeInfo* typeInfo, std::chrono::nanoseconds duration) {
+            foundOnLoadStruct |= (typeInfo == ReflectTypeAndGetTypeInfo<MyOnLoadTestStruct>());
+            foundOtherOnLoadStruct |= (typeInfo == ReflectTypeAndGetTypeInfo<MyOtherOnLoadTestStruct>());
+            allTimed &= (duration.count() >= 0);
+        });
+
+    ENTROPY_VERIFY_FUNC(count >= 2);
+    ENTROPY_VERIFY_FUNC(foundOnLoadStruct);
+    ENTROPY_VERIFY_FUNC(foundOtherOnLoadStruct);
+    ENTROPY_VERIFY_FUNC(allTimed);
+
+    // Everything was drained by the first call
+    ENTROPY_VERIFY_FUNC(InitializeAllReflectedTypes() == 0);
+
+    return 0;
+}
@@ -0,0 +1,86 @@
+// Copyright (c) Entropy Software LLC
+// This file is licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+#include "Entropy/Core/Log.h"
+#include "Entropy/Reflection.h"
+#include "TestMacros.h"
+
+namespace Entropy
+{
+namespace Tests
+{
+namespace TypeInfo
+{
+
+struct MyRegistryTestStruct
+{
+};
+
+struct MyUnreflectedRegistryTestStruct
+{
+};
+
+template <typename T>
+bool CheckFindTypeById()
+{
+    const Entropy::TypeInfo* typeInfo = Entropy::ReflectTypeAndGetTypeInfo<T>();
+    ENTROPY_CHECK_RETURN_VAL_FUNC(typeInfo, false, "Failed to get type info");
+
+    return (Entropy::FindTypeById(typeInfo->GetTypeId()) == typeInfo);
+}
+
+template <typename T>
+bool CheckFindTypeByName()
+{
+    const Entropy::TypeInfo* typeInfo = Entropy::ReflectTypeAndGetTypeInfo<T>();
+    ENTROPY_CHECK_RETURN_VAL_FUNC(typeInfo, false, "Failed to get type info");
+
+    return (Entropy::FindTypeByName(StringOps::GetStr(typeInfo->GetTypeName())) == typeInfo);
+}
+
+struct MyLateRegistryTestStruct
+{
+};
+
+} // namespace TypeInfo
+} // namespace Tests
+} // namespace Entropy
+
+int TypeInfo_TestTypeInfoRegistry(int argc, char** const argv)
+{
+    using namespace Entropy;
+    using namespace Entropy::Tests::TypeInfo;
+
+    ENTROPY_VERIFY_FUNC(CheckFindTypeById<int>());
+    ENTROPY_VERIFY_FUNC(CheckFindTypeById<const char*>());
+    ENTROPY_VERIFY_FUNC(CheckFindTypeById<MyRegistryTestStruct>());
+    ENTROPY_VERIFY_FUNC(CheckFindTypeById<const MyRegistryTestStruct&>());
+
+    // Qualified types register the types they are built from as well
+    ENTROPY_VERIFY_FUNC(FindTypeById(Traits::TypeIdOf<char>{}()) == ReflectTypeAndGetTypeInfo<char>());
+
+    ENTROPY_VERIFY_FUNC(FindTypeById(Traits::TypeIdOf<MyUnreflectedRegistryTestStruct>{}()) == nullptr);
+    ENTROPY_VERIFY_FUNC(FindTypeById(cInvalidTypeId) == nullptr);
+
+    ENTROPY_VERIFY_FUNC(CheckFindTypeByName<int>());
+    ENTROPY_VERIFY_FUNC(CheckFindTypeByName<MyRegistryTestStruct>());
+    ENTROPY_VERIFY_FUNC(CheckFindTypeByName<const MyRegistryTestStruct&>());
+    ENTROPY_VERIFY_FUNC(FindTypeByName("NotARegisteredTypeName") == nullptr);
+    ENTROPY_VERIFY_FUNC(FindTypeByName(nullptr) == nullptr);
+
+    // Only the given length takes part in the compare
+    ENTROPY_VERIFY_FUNC(FindTypeByName("int*", 3) == ReflectTypeAndGetTypeInfo<int>());
+
+    FreezeRegistry();
+
+    ENTROPY_VERIFY_FUNC(CheckFindTypeByName<int>());
+    ENTROPY_VERIFY_FUNC(CheckFindTypeByName<MyRegistryTestStruct>());
+    ENTROPY_VERIFY_FUNC(CheckFindTypeByName<const MyRegistryTestStruct&>());
+    ENTROPY_VERIFY_FUNC(FindTypeByName("NotARegisteredTypeName") == nullptr);
+
+    // Types reflected after freezing are still found
+    ENTROPY_VERIFY_FUNC(CheckFindTypeByName<MyLateRegistryTestStruct>());
+
+    return 0;
+}
@@ -0,0 +1,97 @@
+// Copyright (c) Entropy Software LLC
+// This file is licensed under the MIT License.
+// See the LICENSE file in the project root for more information.
+
+#include "Entropy/Core/Log.h"
+#include "Entropy/Reflection.h"
+#include "TestMacros.h"
+#include <string>
+
+namespace Entropy
+{
+namespace Tests
+{
+namespace TypeInfo
+{
+
+struct MyPodTraitTestStruct
+{
+    int a;
+    float b;
+};
+
+struct MyEmptyTraitTestStruct
+{
+};
+
+struct MyNonTrivialTraitTestStruct
+{
+    std::string name;
+};
+
+struct MyThrowingMoveTraitTestStruct
+{
+    MyThrowingMoveTraitTestStruct() = default;
+    MyThrowingMoveTraitTestStruct(MyThrowingMoveTraitTestStruct&&) {}
+};
+
+struct MyRelocatableTraitTestStruct
+{
+    ENTROPY_REFLECT_CLASS(MyRelocatableTraitTestStruct, TriviallyRelocatable())
+
+    ENTROPY_REFLECT_MEMBER(data)
+    int* data = nullptr;
+
+    ~MyRelocatableTraitTestStruct() { delete data; }
+};
+
+// Attributes are not inherited, so this is not relocatable even though its base class is
+struct MyDerivedRelocatableTraitTestStruct : public MyRelocatableTraitTestStruct
+{
+    ENTROPY_REFLECT_CLASS_WITH_BASE(MyDerivedRelocatableTraitTestStruct, MyRelocatableTraitTestStruct)
+};
+
+} // namespace TypeInfo
+} // namespace Tests
+} // namespace Entropy
+
+int TypeInfo_TestTypeTraitFlags(int argc, char** const argv)
+{
+    using namespace Entropy;
+    using namespace Entropy::Tests::TypeInfo;
+
+    const Entropy::TypeInfo* podTypeInfo = ReflectTypeAndGetTypeInfo<MyPodTraitTestStruct>();
+    ENTROPY_VERIFY_FUNC(podTypeInfo->IsTriviallyCopyable());
+    ENTROPY_VERIFY_FUNC(podTypeInfo->IsTriviallyDestructible());
+    ENTROPY_VERIFY_FUNC(podTypeInfo->IsStandardLayout());
+    ENTROPY_VERIFY_FUNC(podTypeInfo->IsTriviallyRelocatable());
+    ENTROPY_VERIFY_NOT_FUNC(podTypeInfo->IsEmpty());
+    ENTROPY_VERIFY_FUNC(podTypeInfo->IsNothrowMoveConstructible());
+
+    // Qualifiers do not hide the traits of the underlying object type
+    ENTROPY_VERIFY_FUNC(ReflectTypeAndGetTypeInfo<const MyPodTraitTestStruct>()->IsTriviallyCopyable());
+    ENTROPY_VERIFY_FUNC(ReflectTypeAndGetTypeInfo<MyPodTraitTestStruct[4]>()->IsTriviallyCopyable());
+    ENTROPY_VERIFY_FUNC(ReflectTypeAndGetTypeInfo<std::string*>()->IsTriviallyCopyable());
+
+    // References have no storage of their own
+    ENTROPY_VERIFY_NOT_FUNC(ReflectTypeAndGetTypeInfo<MyPodTraitTestStruct&>()->IsTriviallyCopyable());
+
+    ENTROPY_VERIFY_FUNC(ReflectTypeAndGetTypeInfo<MyEmptyTraitTestStruct>()->IsEmpty());
+
+    const Entropy::TypeInfo* nonTrivialTypeInfo = ReflectTypeAndGetTypeInfo<MyNonTrivialTraitTestStruct>();
+    ENTROPY_VERIFY_NOT_FUNC(nonTrivialTypeInfo->IsTriviallyCopyable());
+    ENTROPY_VERIFY_NOT_FUNC(nonTrivialTypeInfo->IsTriviallyDestructible());
+    ENTROPY_VERIFY_NOT_FUNC(nonTrivialTypeInfo->IsTriviallyRelocatable());
+    ENTROPY_VERIFY_FUNC(nonTrivialTypeInfo->IsNothrowMoveConstructible());
+
+    ENTROPY_VERIFY_NOT_FUNC(ReflectTypeAndGetTypeInfo<MyThrowingMoveTraitTestStruct>()->IsNothrowMoveConstructible());
+
+    const Entropy::TypeInfo* relocatableTypeInfo = ReflectTypeAndGetTypeInfo<MyRelocatableTraitTestStruct>();
+    ENTROPY_VERIFY_NOT_FUNC(relocatableTypeInfo->IsTriviallyCopyable());
+    ENTROPY_VERIFY_NOT_FUNC(relocatableTypeInfo->IsTriviallyDestructible());
+    ENTROPY_VERIFY_FUNC(relocatableTypeInfo->IsTriviallyRelocatable());
+
+    ENTROPY_VERIFY_NOT_FUNC(ReflectTypeAndGetTypeInfo<MyDerivedRelocatableTraitTestStruct>()->IsTriviallyRelocatable());
+
+    return 0;
+}